@@ -0,0 +1,413 @@
+/*
+ * Single-file archive of configuration files with a random-access index.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_archive.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include <string>
+#include <memory>
+#include <algorithm>
+
+#include <QDir>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSaveFile>
+#include <QJsonDocument>
+
+#include "qt_print.hpp"
+
+#define ARCHIVE_MAGIC                   "RPARC\0\0\0"
+#define ARCHIVE_VERSION                 1
+
+// Each entry of index takes 20 bytes plus its path at least.
+#define MIN_INDEX_ENTRY_SIZE            20
+
+static inline void append_u32(std::string &buf, uint32_t val)
+{
+    char bytes[4] = { char(val), char(val >> 8), char(val >> 16), char(val >> 24) };
+
+    buf.append(bytes, sizeof(bytes));
+}
+
+static inline void append_u64(std::string &buf, uint64_t val)
+{
+    append_u32(buf, static_cast<uint32_t>(val));
+    append_u32(buf, static_cast<uint32_t>(val >> 32));
+}
+
+static inline uint32_t read_u32(const uchar *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+static inline uint64_t read_u64(const uchar *p)
+{
+    return read_u32(p) | (static_cast<uint64_t>(read_u32(p + 4)) << 32);
+}
+
+RegConfigArchive::RegConfigArchive()
+    : m_data(nullptr)
+    , m_size(0)
+    , m_mtime(0)
+{
+}
+
+RegConfigArchive::~RegConfigArchive()
+{
+    this->close();
+}
+
+int RegConfigArchive::open(const QString &path, QString *err_msg/* = nullptr */)
+{
+    QString err;
+
+    this->close();
+
+    m_file.setFileName(path);
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        if (err_msg)
+            *err_msg = QString("Failed to read file: ") + path + ", reason: " + m_file.errorString();
+
+        return -EIO;
+    }
+
+    m_size = static_cast<size_t>(m_file.size());
+    m_data = (m_size > 0) ? m_file.map(0, m_size) : nullptr;
+    if (nullptr == m_data)
+    {
+        if (err_msg)
+            *err_msg = QString("Failed to map file: ") + path + ", reason: " + m_file.errorString();
+
+        this->close();
+
+        return -EIO;
+    }
+
+    const uchar *ptr = m_data;
+    const uchar *end = m_data + m_size;
+
+    if (m_size < 16 || 0 != memcmp(ptr, ARCHIVE_MAGIC, 8))
+        err = "Not a configuration archive";
+    else if (ARCHIVE_VERSION != read_u32(ptr + 8))
+        err = QString::asprintf("Unsupported version of configuration archive: %u", read_u32(ptr + 8));
+    else
+    {
+        uint32_t count = read_u32(ptr + 12);
+
+        ptr += 16;
+        // Rejects a corrupted count before allocating memory for it.
+        if (count > m_size / MIN_INDEX_ENTRY_SIZE)
+            err = "Corrupted index of configuration archive";
+        else
+            m_entries.reserve(count);
+
+        for (uint32_t i = 0; i < count && err.isEmpty(); ++i)
+        {
+            uint32_t len = (end - ptr >= 4) ? read_u32(ptr) : UINT32_MAX;
+
+            if (static_cast<size_t>(end - ptr) < 4 + static_cast<size_t>(len) + 16)
+            {
+                err = "Truncated index of configuration archive";
+                break;
+            }
+
+            Entry entry;
+
+            entry.path = QString::fromUtf8(reinterpret_cast<const char *>(ptr + 4), len);
+            ptr += 4 + len;
+            entry.offset = read_u64(ptr);
+            entry.packed_size = read_u32(ptr + 8);
+            entry.raw_size = read_u32(ptr + 12);
+            ptr += 16;
+
+            if (entry.offset > m_size || entry.packed_size > m_size - entry.offset)
+                err = QString("Entry out of range: ") + entry.path;
+            else if (!m_entries.empty() && !(m_entries.back().path < entry.path))
+                err = QString("Unsorted or duplicate entry: ") + entry.path;
+            else
+                m_entries.push_back(std::move(entry));
+        }
+    }
+
+    if (!err.isEmpty())
+    {
+        if (err_msg)
+            *err_msg = path + ": " + err;
+
+        this->close();
+
+        return -EINVAL;
+    }
+
+    m_path = path;
+    m_mtime = QFileInfo(path).lastModified().toMSecsSinceEpoch();
+    qtCDebugV(::, "%s: %lu entries indexed.", path.toStdString().c_str(), m_entries.size());
+
+    return 0;
+}
+
+void RegConfigArchive::close(void)
+{
+    if (m_data)
+        m_file.unmap(const_cast<uchar *>(m_data));
+    m_file.close();
+
+    m_path.clear();
+    m_data = nullptr;
+    m_size = 0;
+    m_mtime = 0;
+    m_entries.clear();
+}
+
+const RegConfigArchive::Entry* RegConfigArchive::find(const QString &rel_path) const
+{
+    auto iter = std::lower_bound(m_entries.begin(), m_entries.end(), rel_path,
+        [](const Entry &entry, const QString &key) { return entry.path < key; });
+
+    return (m_entries.end() != iter && iter->path == rel_path) ? &(*iter) : nullptr;
+}
+
+int RegConfigArchive::read(const Entry &entry, QByteArray &bytes, QString *err_msg/* = nullptr */) const
+{
+    // Decompressed right from the mapped pages, only those of this entry read from disk.
+    bytes = qUncompress(m_data + entry.offset, static_cast<int>(entry.packed_size));
+
+    if (static_cast<uint32_t>(bytes.size()) != entry.raw_size)
+    {
+        if (err_msg)
+            *err_msg = m_path + ": Corrupted entry: " + entry.path;
+
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+int RegConfigArchive::pack(const QString &config_dir, const QString &path, QString *err_msg/* = nullptr */)
+{
+    auto dir_filters = QDir::Filter::Dirs | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
+    auto file_filters = QDir::Filter::Files | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
+    auto sort_flags = QDir::SortFlag::Name;
+    QDir dir(config_dir);
+    std::vector<std::pair<QString, QByteArray>> files; // relative path => packed bytes
+    std::vector<uint32_t> raw_sizes;
+
+    if (!dir.exists())
+    {
+        if (err_msg)
+            *err_msg = QString("Non-existent or unreadable directory: ") + config_dir;
+
+        return -ENOENT;
+    }
+
+    for (const QString &vendor : dir.entryList(dir_filters, sort_flags))
+    {
+        QDir vdir(dir.filePath(vendor));
+
+        for (const QString &chip : vdir.entryList(dir_filters, sort_flags))
+        {
+            QDir cdir(vdir.filePath(chip));
+
+            for (const QString &file_name : cdir.entryList(file_filters, sort_flags))
+            {
+                QFile file(cdir.filePath(file_name));
+
+                if (!file.open(QIODevice::ReadOnly))
+                {
+                    if (err_msg)
+                    {
+                        *err_msg = QString("Failed to read file: ") + file.fileName()
+                            + ", reason: " + file.errorString();
+                    }
+
+                    return -EIO;
+                }
+
+                QJsonParseError err;
+                const QJsonDocument &doc = QJsonDocument::fromJson(file.readAll(), &err);
+
+                if (QJsonParseError::NoError != err.error)
+                {
+                    if (err_msg)
+                        *err_msg = file.fileName() + ": " + err.errorString();
+
+                    return -EINVAL;
+                }
+
+                // Re-serialized compactly, since indents and spaces take a large part of hand-written files.
+                const QByteArray &raw = doc.toJson(QJsonDocument::Compact);
+
+                files.push_back({ vendor + "/" + chip + "/" + file_name, qCompress(raw, 9) });
+                raw_sizes.push_back(static_cast<uint32_t>(raw.size()));
+            }
+        }
+    }
+
+    std::vector<size_t> order(files.size());
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&files](size_t a, size_t b) { return files[a].first < files[b].first; });
+
+    std::string index(ARCHIVE_MAGIC, 8);
+    uint64_t offset = 16;
+
+    for (const auto &f : files)
+    {
+        offset += MIN_INDEX_ENTRY_SIZE + f.first.toUtf8().size();
+    }
+
+    append_u32(index, ARCHIVE_VERSION);
+    append_u32(index, static_cast<uint32_t>(files.size()));
+    for (size_t i : order)
+    {
+        const QByteArray &name = files[i].first.toUtf8();
+
+        append_u32(index, static_cast<uint32_t>(name.size()));
+        index.append(name.constData(), name.size());
+        append_u64(index, offset);
+        append_u32(index, static_cast<uint32_t>(files[i].second.size()));
+        append_u32(index, raw_sizes[i]);
+        offset += files[i].second.size();
+    }
+
+    QSaveFile file(path);
+    bool ok = file.open(QIODevice::WriteOnly)
+        && file.write(index.data(), index.size()) == static_cast<qint64>(index.size());
+
+    for (size_t i = 0; ok && i < order.size(); ++i)
+    {
+        const QByteArray &blob = files[order[i]].second;
+
+        ok = (file.write(blob.constData(), blob.size()) == blob.size());
+    }
+
+    if (!ok || !file.commit())
+    {
+        if (err_msg)
+            *err_msg = QString("Failed to write file: ") + path + ", reason: " + file.errorString();
+
+        return -EIO;
+    }
+
+    return static_cast<int>(files.size());
+}
+
+static std::unique_ptr<RegConfigArchive> s_mounted_archive;
+
+int mount_reg_archive(const QString &path, QString *err_msg/* = nullptr */)
+{
+    std::unique_ptr<RegConfigArchive> archive(new RegConfigArchive);
+    int ret = archive->open(path, err_msg);
+
+    if (ret < 0)
+        return ret;
+
+    s_mounted_archive = std::move(archive);
+
+    return 0;
+}
+
+const RegConfigArchive* mounted_reg_archive(void)
+{
+    return s_mounted_archive.get();
+}
+
+// Returns false if path is not inside the mounted archive, or entry is nullptr if it's not found there.
+static bool find_mounted_entry(const QString &path, const RegConfigArchive::Entry *&entry)
+{
+    const RegConfigArchive *archive = s_mounted_archive.get();
+
+    entry = nullptr;
+    if (nullptr == archive)
+        return false;
+
+    const QString &prefix = archive->path();
+
+    if (path.size() <= prefix.size() + 1 || !path.startsWith(prefix) || QChar('/') != path[prefix.size()])
+        return false;
+
+    entry = archive->find(path.mid(prefix.size() + 1));
+
+    return true;
+}
+
+int read_reg_config_file(const QString &path, QByteArray &bytes, QString *err_msg/* = nullptr */)
+{
+    const RegConfigArchive::Entry *entry;
+
+    if (find_mounted_entry(path, entry))
+    {
+        if (entry)
+            return s_mounted_archive->read(*entry, bytes, err_msg);
+
+        if (err_msg)
+            *err_msg = QString("No such file in archive: ") + path;
+
+        return -ENOENT;
+    }
+
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        if (err_msg)
+            *err_msg = QString("Failed to read file: ") + path + ", reason: " + file.errorString();
+
+        return -EIO;
+    }
+
+    bytes = file.readAll();
+
+    return 0;
+}
+
+bool stat_reg_config_file(const QString &path, int64_t &size, int64_t &mtime)
+{
+    const RegConfigArchive::Entry *entry;
+
+    if (find_mounted_entry(path, entry))
+    {
+        size = entry ? entry->raw_size : 0;
+        mtime = s_mounted_archive->mtime();
+
+        return (nullptr != entry);
+    }
+
+    QFileInfo info(path);
+
+    size = info.size();
+    mtime = info.lastModified().toMSecsSinceEpoch();
+
+    return info.exists();
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,131 @@
+/*
+ * Single-file archive of configuration files with a random-access index.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_ARCHIVE_HPP__
+#define __REG_ARCHIVE_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <QString>
+#include <QByteArray>
+#include <QFile>
+
+/*
+ * Archive format (all integers in little-endian):
+ *
+ *   header:  "RPARC\0\0\0", u32 version(1), u32 entry count
+ *   index:   each entry as string of relative path ("vendor/chip/file"),
+ *            u64 offset from the beginning of archive, u32 packed size and u32 raw size,
+ *            sorted by path for binary searching
+ *   blobs:   each entry as compact JSON compressed by qCompress()
+ *
+ * where each string is a u32 length plus UTF-8 bytes without terminator.
+ *
+ * The archive is mapped into memory on opening, so that only the index is read at once,
+ * and each entry is decompressed from the mapped pages on demand.
+ */
+class RegConfigArchive
+{
+private:
+    RegConfigArchive(const RegConfigArchive &) = delete;
+    RegConfigArchive& operator=(const RegConfigArchive &) = delete;
+
+public:
+    struct Entry
+    {
+        QString path; // relative, in the form of "vendor/chip/file"
+        uint64_t offset;
+        uint32_t packed_size;
+        uint32_t raw_size;
+    };
+
+    RegConfigArchive();
+
+    ~RegConfigArchive();
+
+public:
+    // Returns 0 on success, or a negative errno with err_msg filled.
+    int open(const QString &path, QString *err_msg = nullptr);
+
+    void close(void);
+
+    inline const QString& path(void) const
+    {
+        return m_path;
+    }
+
+    inline int64_t mtime(void) const
+    {
+        return m_mtime;
+    }
+
+    inline const std::vector<Entry>& entries(void) const
+    {
+        return m_entries;
+    }
+
+    const Entry* find(const QString &rel_path) const;
+
+    // Thread-safe. Returns 0 on success, or a negative errno with err_msg filled.
+    int read(const Entry &entry, QByteArray &bytes, QString *err_msg = nullptr) const;
+
+    /*
+     * Packs all files of config_dir in the layout of "vendor/chip/file" into an archive,
+     * each of which must be a valid JSON document. Returns the number of packed files,
+     * or a negative errno with err_msg filled.
+     */
+    static int pack(const QString &config_dir, const QString &path, QString *err_msg = nullptr);
+
+private:
+    QString m_path;
+    QFile m_file;
+    const uchar *m_data; // mapped
+    size_t m_size;
+    int64_t m_mtime;
+    std::vector<Entry> m_entries;
+};
+
+/*
+ * Mounts an archive in place of a configuration directory, after which files inside it
+ * are addressed as ARCHIVE_PATH/vendor/chip/file by all functions below and loaders
+ * built on them. Not thread-safe, so it must be called before any loading.
+ */
+int mount_reg_archive(const QString &path, QString *err_msg = nullptr);
+
+const RegConfigArchive* mounted_reg_archive(void); // nullptr if none
+
+// Reads a configuration file from the mounted archive if it's inside, or from file system otherwise.
+int read_reg_config_file(const QString &path, QByteArray &bytes, QString *err_msg = nullptr);
+
+// Files inside the mounted archive take its mtime, and their raw sizes. Returns false if not found.
+bool stat_reg_config_file(const QString &path, int64_t &size, int64_t &mtime);
+
+#endif /* #ifndef __REG_ARCHIVE_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
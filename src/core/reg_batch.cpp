@@ -0,0 +1,306 @@
+/*
+ * Batch decoding of register dumps into columnar output.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_batch.hpp"
+
+#include <errno.h>
+
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+
+#include <QFile>
+#include <QDir>
+#include <QFileInfo>
+
+#include "qt_print.hpp"
+#include "reg_decoder.hpp"
+#include "work_pool.hpp"
+
+#define BINARY_MAGIC                    "RPCOL\0\0\0"
+#define BINARY_VERSION                  1
+#define COLUMN_COUNT                    7
+
+static inline void append_u32(std::string &buf, uint32_t val)
+{
+    char bytes[4] = { char(val), char(val >> 8), char(val >> 16), char(val >> 24) };
+
+    buf.append(bytes, sizeof(bytes));
+}
+
+static inline void append_u64(std::string &buf, uint64_t val)
+{
+    append_u32(buf, static_cast<uint32_t>(val));
+    append_u32(buf, static_cast<uint32_t>(val >> 32));
+}
+
+static std::string csv_quote(const std::string &str)
+{
+    std::string result("\"");
+
+    for (char c : str)
+    {
+        if ('"' == c)
+            result += '"';
+        result += c;
+    }
+
+    return result + '"';
+}
+
+RegBatchDecoder::RegBatchDecoder(const RegConfig &config, const QString &module_name,
+    int delim_index, AddrBaseMethod method, uint64_t addr_base)
+    : m_config(config)
+    , m_module_name(module_name)
+    , m_delim_index(delim_index)
+    , m_method(method)
+    , m_addr_base(addr_base)
+{
+    for (const auto &module : m_config.modules)
+    {
+        uint32_t module_id = this->intern(module->name);
+
+        for (const auto &reg : module->registers)
+        {
+            RegIds &ids = m_reg_ids[&reg];
+
+            ids.module = module_id;
+            ids.key = this->intern(reg.key);
+            ids.fields.reserve(reg.fields.size());
+            for (const auto &field : reg.fields)
+            {
+                ids.fields.push_back({ this->intern(field.range), this->intern(field.name()) });
+            }
+        }
+    }
+}
+
+uint32_t RegBatchDecoder::intern(const QString &str)
+{
+    const std::string &s = str.toStdString();
+    auto iter = m_dict_index.find(s);
+
+    if (m_dict_index.end() != iter)
+        return iter->second;
+
+    m_dict.push_back(s);
+    m_dict_index.insert({ s, m_dict.size() - 1 });
+
+    return m_dict.size() - 1;
+}
+
+void RegBatchDecoder::collect_files(const std::vector<std::string> &paths, std::vector<std::string> &files)
+{
+    for (const auto &path : paths)
+    {
+        QFileInfo info(QString::fromStdString(path));
+
+        if (!info.isDir())
+        {
+            files.push_back(path);
+            continue;
+        }
+
+        QDir dir(QString::fromStdString(path));
+        std::vector<std::string> children;
+
+        for (const QString &name : dir.entryList(QDir::Dirs | QDir::Files | QDir::NoDotAndDotDot, QDir::Name))
+        {
+            children.push_back(path + "/" + name.toStdString());
+        }
+        collect_files(children, files);
+    }
+}
+
+int RegBatchDecoder::run(const std::vector<std::string> &dump_files, FILE *out, Format format, int worker_count)
+{
+    RegDecoder decoder(m_config, m_module_name, m_method, m_addr_base);
+
+    if (!decoder.valid())
+    {
+        qtCErrV(::, "Cannot find module: %s", m_module_name.toStdString().c_str());
+
+        return -ENOENT;
+    }
+
+    std::vector<uint32_t> dump_ids;
+
+    dump_ids.reserve(dump_files.size());
+    for (const auto &path : dump_files)
+    {
+        dump_ids.push_back(this->intern(QString::fromStdString(path)));
+    }
+
+    std::vector<std::string> csv_dict;
+    std::string header;
+
+    if (CSV == format)
+    {
+        csv_dict.reserve(m_dict.size());
+        for (const auto &s : m_dict)
+        {
+            csv_dict.push_back(csv_quote(s));
+        }
+        header = "dump,module,register,addr,bits,field,value\n";
+    }
+    else
+    {
+        header.assign(BINARY_MAGIC, 8);
+        append_u32(header, BINARY_VERSION);
+        append_u32(header, COLUMN_COUNT);
+    }
+
+    if (fwrite(header.data(), 1, header.size(), out) != header.size())
+        return -EIO;
+
+    WorkStealingPool pool(worker_count);
+    std::mutex out_mutex;
+    std::atomic<int> fail_count(0);
+    std::atomic<bool> out_failed(false);
+
+    pool.run(dump_files.size(), [&](size_t task_index, int /* worker_index */) {
+        const std::string &path = dump_files[task_index];
+        QFile file(QString::fromStdString(path));
+        std::vector<RegArrayItem> items;
+        QString err_msg;
+
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            qtCErrV(::, "Failed to read file: %s, reason: %s", path.c_str(), file.errorString().toStdString().c_str());
+            ++fail_count;
+
+            return;
+        }
+
+        if (parse_register_array_items(file.readAll().constData(), m_delim_index, items, &err_msg) < 0)
+        {
+            qtCErrV(::, "%s: %s", path.c_str(), err_msg.toStdString().c_str());
+            ++fail_count;
+
+            return;
+        }
+
+        uint32_t dump_id = dump_ids[task_index];
+        std::string block;
+        std::vector<uint32_t> module_col, reg_col, bits_col, field_col;
+        std::vector<uint64_t> addr_col, value_col;
+
+        for (const auto &item : items)
+        {
+            const RegModule *module = nullptr;
+            const RegInfo *reg = decoder.find_register(item.addr, &module);
+
+            if (nullptr == reg)
+            {
+                qtCDebugV(::, "%s: No such a register with address = 0x%lx", path.c_str(), item.addr);
+                continue;
+            }
+
+            const RegIds &ids = m_reg_ids.at(reg);
+
+            for (size_t i = 0; i < reg->fields.size(); ++i)
+            {
+                uint64_t bits_value = reg->fields[i].extract(item.value);
+
+                if (CSV == format)
+                {
+                    char numbers[48];
+
+                    snprintf(numbers, sizeof(numbers), "0x%lx", item.addr);
+                    block.append(csv_dict[dump_id]).append(1, ',').append(csv_dict[ids.module]).append(1, ',')
+                        .append(csv_dict[ids.key]).append(1, ',').append(numbers).append(1, ',')
+                        .append(csv_dict[ids.fields[i].bits]).append(1, ',')
+                        .append(csv_dict[ids.fields[i].name]).append(1, ',');
+                    snprintf(numbers, sizeof(numbers), "0x%lx\n", bits_value);
+                    block.append(numbers);
+                }
+                else
+                {
+                    module_col.push_back(ids.module);
+                    reg_col.push_back(ids.key);
+                    addr_col.push_back(item.addr);
+                    bits_col.push_back(ids.fields[i].bits);
+                    field_col.push_back(ids.fields[i].name);
+                    value_col.push_back(bits_value);
+                }
+            }
+        } // for (item : items)
+
+        if (BINARY == format && !addr_col.empty())
+        {
+            size_t rows = addr_col.size();
+
+            block.reserve(4 + rows * (5 * 4 + 2 * 8));
+            append_u32(block, rows);
+            for (size_t i = 0; i < rows; ++i)
+                append_u32(block, dump_id);
+            for (auto v : module_col)
+                append_u32(block, v);
+            for (auto v : reg_col)
+                append_u32(block, v);
+            for (auto v : addr_col)
+                append_u64(block, v);
+            for (auto v : bits_col)
+                append_u32(block, v);
+            for (auto v : field_col)
+                append_u32(block, v);
+            for (auto v : value_col)
+                append_u64(block, v);
+        }
+
+        if (block.empty())
+            return;
+
+        std::lock_guard<std::mutex> lock(out_mutex);
+
+        if (fwrite(block.data(), 1, block.size(), out) != block.size())
+            out_failed = true;
+    });
+
+    if (BINARY == format)
+    {
+        std::string tail;
+
+        append_u32(tail, 0); // end mark of row groups
+        append_u32(tail, m_dict.size());
+        for (const auto &s : m_dict)
+        {
+            append_u32(tail, s.size());
+            tail.append(s);
+        }
+
+        if (fwrite(tail.data(), 1, tail.size(), out) != tail.size())
+            out_failed = true;
+    }
+
+    if (out_failed || 0 != fflush(out))
+        return -EIO;
+
+    return fail_count;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Access compiled modules via shared pointers.
+ */
+
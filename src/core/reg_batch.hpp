@@ -0,0 +1,112 @@
+/*
+ * Batch decoding of register dumps into columnar output.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_BATCH_HPP__
+#define __REG_BATCH_HPP__
+
+#include <stdio.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <QString>
+
+#include "reg_schema.hpp"
+#include "reg_codec.hpp"
+
+/*
+ * Each row is a (dump, register, field) tuple, with columns:
+ *
+ *   dump, module, register, addr, bits, field, value
+ *
+ * CSV output has a header line, and all string columns quoted.
+ *
+ * Binary output (all integers in little-endian):
+ *
+ *   header:     "RPCOL\0\0\0", u32 version(1), u32 column count(7)
+ *   row group:  u32 row count (non-zero), then each column of this group in turn:
+ *                   dump: u32[], module: u32[], register: u32[], addr: u64[], bits: u32[], field: u32[], value: u64[]
+ *               where u32 columns other than addr and value are indexes of the string dictionary
+ *   end mark:   u32 0
+ *   dictionary: u32 string count, then each string as u32 length plus UTF-8 bytes without terminator
+ *
+ * Row groups, one per dump, appear in the order of completion rather than that of inputs.
+ */
+class RegBatchDecoder
+{
+public:
+    enum Format
+    {
+        CSV,
+        BINARY,
+    };
+
+    RegBatchDecoder() = delete;
+
+    // All modules with "__base__" are looked up by absolute addresses if module_name is empty.
+    RegBatchDecoder(const RegConfig &config, const QString &module_name,
+        int delim_index, AddrBaseMethod method, uint64_t addr_base);
+
+public:
+    // Returns the number of dumps failed to read or parse, or a negative errno on output error.
+    int run(const std::vector<std::string> &dump_files, FILE *out, Format format, int worker_count);
+
+    // Expands directories recursively into sorted regular files.
+    static void collect_files(const std::vector<std::string> &paths, std::vector<std::string> &files);
+
+private:
+    uint32_t intern(const QString &str);
+
+private:
+    struct FieldIds
+    {
+        uint32_t bits;
+        uint32_t name;
+    };
+
+    struct RegIds
+    {
+        uint32_t module;
+        uint32_t key;
+        std::vector<FieldIds> fields;
+    };
+
+    const RegConfig &m_config;
+    QString m_module_name;
+    int m_delim_index;
+    AddrBaseMethod m_method;
+    uint64_t m_addr_base;
+    // All fixed before workers start, and read-only afterwards.
+    std::vector<std::string> m_dict;
+    std::unordered_map<std::string, uint32_t> m_dict_index;
+    std::unordered_map<const RegInfo *, RegIds> m_reg_ids;
+};
+
+#endif /* #ifndef __REG_BATCH_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,172 @@
+/*
+ * Text formats of register arrays shared by the GUI and headless modes.
+ *
+ * Copyright (c) 2024-2025 Man Hung-Coeng <udc577@126.com>
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_codec.hpp"
+
+#include <errno.h>
+
+AddrBaseMethod parse_addr_base_method(const QString &method)
+{
+    if (0 == method.compare("Ignore", Qt::CaseInsensitive))
+        return ADDR_BASE_IGNORE;
+
+    if (0 == method.compare("Add", Qt::CaseInsensitive))
+        return ADDR_BASE_ADD;
+
+    if (0 == method.compare("Subtract", Qt::CaseInsensitive))
+        return ADDR_BASE_SUBTRACT;
+
+    if (0 == method.compare("Global", Qt::CaseInsensitive))
+        return ADDR_BASE_GLOBAL;
+
+    return ADDR_BASE_UNKNOWN;
+}
+
+const char* bitwidth_format_string(int bitwidth)
+{
+    if (8 == bitwidth)
+        return "0x%02lx";
+
+    if (16 == bitwidth)
+        return "0x%04lx";
+
+    if (64 == bitwidth)
+        return "0x%016lx";
+
+    return "0x%08lx";
+}
+
+void append_register_array_item(QString &result, int delim_index,
+    const char *addr_fmt, const char *value_fmt, uint64_t addr, uint64_t value)
+{
+    result.append(left_delimiter(delim_index)).append(' ')
+        .append(QString::asprintf(addr_fmt, addr)).append(", ")
+        .append(QString::asprintf(value_fmt, value))
+        .append(' ').append(right_delimiter(delim_index)).append(",\n");
+}
+
+#define IS_HEX_CHAR(c)          (((c) >= '0' && (c) <= '9') || ((c) >= 'A' && (c) <= 'F') || ((c) >= 'a' && (c) <= 'f'))
+
+int parse_register_array_items(const char *text, int delim_index, std::vector<RegArrayItem> &items, QString *err_msg)
+{
+    const char left_delim = left_delimiter(delim_index);
+    const char right_delim = right_delimiter(delim_index);
+    const char *ptr = text;
+    uint64_t addr = 0;
+    uint64_t value = 0;
+    QString err;
+
+    if (nullptr == err_msg)
+        err_msg = &err;
+
+#define IS_DELIM_OR_NULL(c)     ((left_delim == (c)) || (right_delim == (c)) || ('\0' == (c)))
+
+    while (true)
+    {
+        int item_seq = items.size() + 1;
+
+        if (left_delim != *ptr)
+            while ('\0' != *ptr && left_delim != *++ptr);
+
+        if ('\0' == *ptr) // Empty text, or the final array item.
+            break;
+
+        char c;
+
+        do
+        {
+            c = *++ptr;
+
+            if (IS_HEX_CHAR(c) || IS_DELIM_OR_NULL(c))
+                break;
+        }
+        while (true);
+
+        if (IS_DELIM_OR_NULL(c))
+        {
+            *err_msg = QString::asprintf("No address for item[%d]!", item_seq);
+
+            return -EINVAL;
+        }
+
+        char *end_ptr;
+
+        addr = strtoull(ptr, &end_ptr, 16);
+
+        if (/*'\0' != *ptr && */'\0' == *end_ptr) // Entire string has been parsed.
+        {
+            *err_msg = QString::asprintf("No value for item[%d]!", item_seq);
+
+            return -EINVAL;
+        }
+
+        ptr = end_ptr;
+        do
+        {
+            c = *++ptr;
+
+            if (IS_HEX_CHAR(c) || IS_DELIM_OR_NULL(c))
+                break;
+        }
+        while (true);
+
+        if (IS_DELIM_OR_NULL(c))
+        {
+            *err_msg = QString::asprintf("No value for item[%d]!", item_seq);
+
+            return -EINVAL;
+        }
+
+        value = strtoull(ptr, &end_ptr, 16);
+
+        ptr = end_ptr;
+        do
+        {
+            c = *ptr++;
+
+            if ((right_delim == c) || (left_delim == c) || ('\0' == c))
+                break;
+        }
+        while (true);
+
+        if (right_delim != c)
+        {
+            *err_msg = QString::asprintf("No %c for item[%d]!", right_delim, item_seq);
+
+            return -EINVAL;
+        }
+
+        items.push_back({ addr, value });
+    } // while (true)
+
+#undef IS_DELIM_OR_NULL
+
+    return 0;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit, with some code moved from regpanel.cpp.
+ *  02. Move the parser of register array items from regpanel.cpp.
+ */
+
@@ -0,0 +1,102 @@
+/*
+ * Text formats of register arrays shared by the GUI and headless modes.
+ *
+ * Copyright (c) 2024-2025 Man Hung-Coeng <udc577@126.com>
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_CODEC_HPP__
+#define __REG_CODEC_HPP__
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <QString>
+
+enum RegArrayDelim
+{
+    CURLY_BRACES,
+    SQUARE_BRACKETS
+};
+
+static inline char left_delimiter(int delim_index)
+{
+    return (CURLY_BRACES == delim_index) ? '{' : '[';
+}
+
+static inline char right_delimiter(int delim_index)
+{
+    return (CURLY_BRACES == delim_index) ? '}' : ']';
+}
+
+enum AddrBaseMethod
+{
+    ADDR_BASE_IGNORE,
+    ADDR_BASE_ADD,
+    ADDR_BASE_SUBTRACT,
+    ADDR_BASE_GLOBAL, // base of each module from the "__base__" property
+    ADDR_BASE_UNKNOWN
+};
+
+// Case-insensitive, the same as texts of the address base pull-down list.
+AddrBaseMethod parse_addr_base_method(const QString &method);
+
+// Converts a register offset into the address to output.
+static inline uint64_t apply_addr_base(uint64_t offset, AddrBaseMethod method, uint64_t addr_base, uint64_t module_base)
+{
+    if (ADDR_BASE_ADD == method)
+        return offset + addr_base;
+
+    if (ADDR_BASE_SUBTRACT == method)
+        return offset - addr_base;
+
+    if (ADDR_BASE_GLOBAL == method)
+        return offset + module_base;
+
+    return offset;
+}
+
+const char* bitwidth_format_string(int bitwidth);
+
+// Appends a line like: "{ 0x0040, 0x0101 },"
+void append_register_array_item(QString &result, int delim_index,
+    const char *addr_fmt, const char *value_fmt, uint64_t addr, uint64_t value);
+
+struct RegArrayItem
+{
+    uint64_t addr;
+    uint64_t value;
+};
+
+/*
+ * Parses items like "{ 0x0040, 0x0101 }," till the end of text.
+ * Returns 0 on success, or -EINVAL with err_msg filled on the first malformed item,
+ * in which case items parsed before it are still kept.
+ */
+int parse_register_array_items(const char *text, int delim_index, std::vector<RegArrayItem> &items, QString *err_msg);
+
+#endif /* #ifndef __REG_CODEC_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit, with some code moved from regpanel.cpp.
+ *  02. Move the parser of register array items from regpanel.cpp.
+ */
+
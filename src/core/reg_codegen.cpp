@@ -0,0 +1,330 @@
+/*
+ * Source code generators from compiled register configurations.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_codegen.hpp"
+
+#include <ctype.h>
+
+#include <set>
+#include <algorithm>
+
+#include <QFileInfo>
+
+#include "reg_encoder.hpp"
+
+static QString c_identifier(const QString &name)
+{
+    std::string result = name.trimmed().toStdString();
+
+    for (char &c : result)
+    {
+        c = isalnum(static_cast<unsigned char>(c)) ? toupper(static_cast<unsigned char>(c)) : '_';
+    }
+
+    if (result.empty() || isdigit(static_cast<unsigned char>(result[0])))
+        result.insert(0, "REG_");
+
+    return QString::fromStdString(result);
+}
+
+static const char* uint_type_name(int bitwidth)
+{
+    return (bitwidth <= 8) ? "uint8_t" : ((bitwidth <= 16) ? "uint16_t" : ((bitwidth <= 32) ? "uint32_t" : "uint64_t"));
+}
+
+static QString field_identifier(const RegField &field)
+{
+    if (BITS_ITEM_DESC_MISSING == field.desc_type || BITS_ITEM_DESC_TODO == field.desc_type || field.name().isEmpty())
+        return QString::asprintf("BITS_%d_%d", field.high, field.low);
+
+    return c_identifier(field.name());
+}
+
+static const char *FIELD_TEMPLATE =
+    "#ifndef __REGPANEL_FIELD_TEMPLATE__\n"
+    "#define __REGPANEL_FIELD_TEMPLATE__\n"
+    "\n"
+    "namespace regpanel\n"
+    "{\n"
+    "\n"
+    "template<typename RegT, unsigned HIGH, unsigned LOW>\n"
+    "struct Field\n"
+    "{\n"
+    "    typedef RegT reg_type;\n"
+    "\n"
+    "    static constexpr unsigned SHIFT = LOW;\n"
+    "    static constexpr RegT MASK = ((HIGH - LOW + 1 >= sizeof(RegT) * 8) ? static_cast<RegT>(~static_cast<RegT>(0))\n"
+    "        : static_cast<RegT>((static_cast<RegT>(1) << (HIGH - LOW + 1)) - 1)) << LOW;\n"
+    "\n"
+    "    static constexpr RegT get(RegT reg)\n"
+    "    {\n"
+    "        return (reg & MASK) >> SHIFT;\n"
+    "    }\n"
+    "\n"
+    "    static constexpr RegT set(RegT reg, RegT value)\n"
+    "    {\n"
+    "        return (reg & ~MASK) | ((value << SHIFT) & MASK);\n"
+    "    }\n"
+    "};\n"
+    "\n"
+    "template<typename F>\n"
+    "constexpr typename F::reg_type get(typename F::reg_type reg)\n"
+    "{\n"
+    "    return F::get(reg);\n"
+    "}\n"
+    "\n"
+    "template<typename F>\n"
+    "constexpr typename F::reg_type set(typename F::reg_type reg, typename F::reg_type value)\n"
+    "{\n"
+    "    return F::set(reg, value);\n"
+    "}\n"
+    "\n"
+    "} // namespace regpanel\n"
+    "\n"
+    "#endif /* #ifndef __REGPANEL_FIELD_TEMPLATE__ */\n";
+
+static void generate_module(const RegConfig &config, const RegModule &module, QString &result)
+{
+    const char *reg_type = uint_type_name(config.data_bits);
+    const char *value_fmt = bitwidth_format_string(config.data_bits);
+    uint64_t max_addr = 0;
+
+    for (const auto &reg : module.registers)
+    {
+        max_addr = std::max(max_addr, (module.has_base ? module.base : 0) + reg.offset);
+    }
+
+    const char *addr_type = uint_type_name(std::max(config.addr_bits, (max_addr > UINT32_MAX) ? 64 : 32));
+    const QString &prefix = c_identifier(module.prefix.isEmpty() ? (module.name + "_") : module.prefix);
+
+    result += QString("\n/*\n * %1\n */\n").arg(module.name);
+    if (module.has_base)
+        result += QString::asprintf("\nconstexpr %s %sBASE = 0x%lx;\n", addr_type, prefix.toStdString().c_str(), module.base);
+
+    for (const auto &reg : module.registers)
+    {
+        std::set<QString> field_names = { "OFFSET", "ADDR", "DEFAULT" }; // taken by constants above
+
+        result += QString::asprintf("\n// %s\nnamespace %s%s\n{\n", reg.key.toStdString().c_str(),
+            prefix.toStdString().c_str(), c_identifier(reg.name).toStdString().c_str());
+        result += QString::asprintf("    constexpr %s OFFSET = 0x%04lx;\n", addr_type, reg.offset);
+        if (module.has_base)
+            result += QString::asprintf("    constexpr %s ADDR = 0x%lx;\n", addr_type, module.base + reg.offset);
+        result += QString::asprintf((QString("    constexpr %s DEFAULT = ") + value_fmt + ";\n").toStdString().c_str(),
+            reg_type, reg.default_value);
+
+        for (const auto &field : reg.fields)
+        {
+            if (BITS_ITEM_DESC_RESERVED == field.desc_type)
+                continue;
+
+            QString name = field_identifier(field);
+
+            if (!field_names.insert(name).second) // duplicate names within a register
+            {
+                name += QString::asprintf("_%d_%d", field.high, field.low);
+                field_names.insert(name);
+            }
+
+            const std::string &name_str = name.toStdString();
+
+            result += QString::asprintf("\n    constexpr unsigned %s_SHIFT = %d;\n", name_str.c_str(), field.low);
+            result += QString::asprintf((QString("    constexpr %s %s_MASK = ") + value_fmt + ";\n").toStdString().c_str(),
+                reg_type, name_str.c_str(), field.mask());
+            result += QString::asprintf("    typedef regpanel::Field<%s, %d, %d> %s; // %s%s\n", reg_type,
+                field.high, field.low, name_str.c_str(), field.readonly ? "RO" : "RW",
+                field.hint.isEmpty() ? "" : (", " + field.hint.simplified()).toStdString().c_str());
+        }
+
+        result += QString::asprintf("} // namespace %s%s\n",
+            prefix.toStdString().c_str(), c_identifier(reg.name).toStdString().c_str());
+    }
+}
+
+QString generate_cpp_header(const RegConfig &config, const QString &module_name, QString *err_msg)
+{
+    const RegModule *selected_module = module_name.isEmpty() ? nullptr : config.find_module(module_name);
+
+    if (!module_name.isEmpty() && nullptr == selected_module)
+    {
+        if (err_msg)
+            *err_msg = "No such a module: " + module_name;
+
+        return QString();
+    }
+
+    const QString &file_name = QFileInfo(config.path).fileName();
+    const QString &guard = "__REGPANEL_" + c_identifier(QFileInfo(config.path).completeBaseName()
+        + (selected_module ? ("_" + selected_module->prefix + selected_module->name) : QString())) + "_HPP__";
+    QString result;
+
+    result += "/*\n * Generated by regpanel from " + file_name + ", do not edit.\n */\n\n";
+    result += "#ifndef " + guard + "\n#define " + guard + "\n\n#include <stdint.h>\n\n";
+    result += FIELD_TEMPLATE;
+
+    for (const auto &module : config.modules)
+    {
+        if (nullptr == selected_module || module.get() == selected_module)
+            generate_module(config, *module, result);
+    }
+
+    result += "\n#endif /* #ifndef " + guard + " */\n";
+
+    return result;
+}
+
+typedef std::vector<std::pair<uint64_t, uint64_t>> AddrRanges; // [first, last]
+
+static void append_address(AddrRanges &ranges, uint64_t addr, uint64_t stride)
+{
+    // Addresses are appended in ascending order.
+    if (!ranges.empty() && addr <= ranges.back().second + stride)
+        ranges.back().second = std::max(ranges.back().second, addr);
+    else
+        ranges.push_back({ addr, addr });
+}
+
+// The comment goes right above the table, if any.
+static void append_access_table(const QString &name, const AddrRanges &ranges, const char *addr_fmt, QString &result,
+    const QString &comment = QString())
+{
+    result += "\n";
+    if (!comment.isEmpty())
+        result += "/* " + comment + " */\n";
+
+    if (ranges.empty())
+    {
+        result += "/* No registers for " + name + "_table. */\n";
+
+        return;
+    }
+
+    const QString &range_fmt = QString("\tregmap_reg_range(") + addr_fmt + ", " + addr_fmt + "),\n";
+
+    result += "static const struct regmap_range " + name + "_ranges[] = {\n";
+    for (const auto &range : ranges)
+    {
+        result += QString::asprintf(range_fmt.toStdString().c_str(), range.first, range.second);
+    }
+    result += "};\n";
+
+    result += "\nstatic const struct regmap_access_table " + name + "_table = {\n";
+    result += "\t.yes_ranges = " + name + "_ranges,\n";
+    result += "\t.n_yes_ranges = ARRAY_SIZE(" + name + "_ranges),\n";
+    result += "};\n";
+}
+
+QString generate_regmap_tables(const RegConfig &config, const QString &module_name, const RegEncoder *encoder,
+    AddrBaseMethod method, uint64_t addr_base, QString *err_msg)
+{
+    const RegModule *selected_module = module_name.isEmpty() ? nullptr : config.find_module(module_name);
+
+    if (!module_name.isEmpty() && nullptr == selected_module)
+    {
+        if (err_msg)
+            *err_msg = "No such a module: " + module_name;
+
+        return QString();
+    }
+
+    const char *addr_fmt = bitwidth_format_string(config.addr_bits);
+    const char *value_fmt = bitwidth_format_string(config.data_bits);
+    uint64_t stride = (config.data_bits > 8) ? (config.data_bits / 8) : 1;
+    QString result;
+
+    result += "/*\n * Generated by regpanel from " + QFileInfo(config.path).fileName() + ", do not edit.\n */\n";
+
+    for (size_t i = 0; i < config.modules.size(); ++i)
+    {
+        const RegModule &module = *config.modules[i];
+
+        if (selected_module && &module != selected_module)
+            continue;
+
+        QString name = c_identifier(module.prefix.isEmpty() ? module.name : module.prefix).toLower();
+        std::vector<std::pair<uint64_t, const RegInfo *>> regs;
+        AddrRanges rd_ranges;
+        AddrRanges wr_ranges;
+        AddrRanges volatile_ranges;
+
+        while (name.endsWith('_'))
+            name.chop(1);
+
+        regs.reserve(module.registers.size());
+        for (const auto &reg : module.registers)
+        {
+            regs.push_back({ apply_addr_base(reg.offset, method, addr_base, module.base), &reg });
+        }
+        std::sort(regs.begin(), regs.end(), [](const std::pair<uint64_t, const RegInfo *> &a,
+            const std::pair<uint64_t, const RegInfo *> &b) {
+            return a.first < b.first;
+        });
+
+        for (const auto &pair : regs)
+        {
+            append_address(rd_ranges, pair.first, stride);
+            if (pair.second->rw_mask)
+                append_address(wr_ranges, pair.first, stride);
+            if (pair.second->is_volatile)
+                append_address(volatile_ranges, pair.first, stride);
+        }
+
+        result += QString("\n/*\n * %1\n */\n").arg(module.name);
+        if (!regs.empty())
+        {
+            result += QString::asprintf((QString("\n#define %s_MAX_REGISTER\t") + addr_fmt + "\n").toStdString().c_str(),
+                name.toUpper().toStdString().c_str(), regs.back().first);
+        }
+
+        const std::vector<RegArrayItem> &items = encoder ? encoder->module_items(i, method, addr_base)
+            : std::vector<RegArrayItem>();
+
+        if (!items.empty())
+        {
+            const QString &item_fmt = QString("\t{ ") + addr_fmt + ", " + value_fmt + " },\n";
+
+            result += "\nstatic const struct reg_sequence " + name + "_init_regs[] = {\n";
+            for (const auto &item : items)
+            {
+                result += QString::asprintf(item_fmt.toStdString().c_str(), item.addr, item.value);
+            }
+            result += "};\n";
+        }
+
+        append_access_table(name + "_rd", rd_ranges, addr_fmt, result);
+        append_access_table(name + "_wr", wr_ranges, addr_fmt, result);
+        append_access_table(name + "_volatile", volatile_ranges, addr_fmt, result,
+            "Registers listed in \"__volatile__\" of the module only, since read-only bits are mostly constant.");
+    } // for (i : config.modules.size())
+
+    return result;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Add generate_regmap_tables() for Linux kernel drivers.
+ *  03. Access compiled modules via shared pointers.
+ *  04. Mark registers volatile only if they're listed in "__volatile__" of the module,
+ *      instead of any with read-only fields, and document the rule in the generated tables.
+ */
+
@@ -0,0 +1,95 @@
+/*
+ * Source code generators from compiled register configurations.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_CODEGEN_HPP__
+#define __REG_CODEGEN_HPP__
+
+#include <QString>
+
+#include "reg_schema.hpp"
+#include "reg_codec.hpp"
+
+class RegEncoder;
+
+/*
+ * Generates a C++11 header of the specified module, or all modules if module_name is empty.
+ * Every register gets a namespace named by "__prefix__" of module plus its name, e.g.:
+ *
+ *   namespace CSI2HOST_N_LANES
+ *   {
+ *       constexpr uint32_t OFFSET = 0x0004;
+ *       constexpr uint32_t ADDR = 0xfdd30004; // base + offset, only if the module has a "__base__"
+ *       constexpr uint32_t DEFAULT = 0x00000003;
+ *       constexpr unsigned N_LANES_SHIFT = 0;
+ *       constexpr uint32_t N_LANES_MASK = 0x00000003;
+ *       typedef regpanel::Field<uint32_t, 1, 0> N_LANES;
+ *   }
+ *
+ * where regpanel::Field<> provides constexpr get() and set(), each of which is a single shift-and-mask,
+ * e.g.: CSI2HOST_N_LANES::N_LANES::get(value), or regpanel::get<CSI2HOST_N_LANES::N_LANES>(value).
+ * Reserved fields are skipped, and fields without names are named by bits ranges, e.g.: BITS_7_4.
+ *
+ * Returns an empty string with err_msg filled if the module is not found.
+ */
+QString generate_cpp_header(const RegConfig &config, const QString &module_name, QString *err_msg);
+
+/*
+ * Generates tables for Linux kernel drivers using regmap, of the specified module or all modules
+ * if module_name is empty, each named by the lower-case "__prefix__" of module, e.g.:
+ *
+ *   static const struct reg_sequence csi2host_init_regs[] = {
+ *       { 0x0004, 0x00000003 },
+ *   };
+ *
+ *   static const struct regmap_range csi2host_wr_ranges[] = {
+ *       regmap_reg_range(0x0004, 0x0004),
+ *       regmap_reg_range(0x0010, 0x0014),
+ *   };
+ *
+ *   static const struct regmap_access_table csi2host_wr_table = {
+ *       .yes_ranges = csi2host_wr_ranges,
+ *       .n_yes_ranges = ARRAY_SIZE(csi2host_wr_ranges),
+ *   };
+ *
+ * where:
+ *   init_regs:     values assigned via encoder, or omitted if encoder is nullptr or nothing assigned;
+ *   rd_table:      all registers;
+ *   wr_table:      registers with any read-write fields;
+ *   volatile_table: registers listed in "__volatile__" of the module, i.e.: updated by hardware,
+ *                  so that the others are served from regmap cache without bus reads. Read-only fields
+ *                  alone don't make a register volatile, since most of them are constant, e.g.: IDs and versions.
+ * Addresses of registers adjacent by data width are merged into one range.
+ * Tables without any ranges are omitted, since zero-length arrays are not allowed.
+ *
+ * Returns an empty string with err_msg filled if the module is not found.
+ */
+QString generate_regmap_tables(const RegConfig &config, const QString &module_name, const RegEncoder *encoder,
+    AddrBaseMethod method, uint64_t addr_base, QString *err_msg);
+
+#endif /* #ifndef __REG_CODEGEN_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Derive volatile_table from "__volatile__" of modules instead of read-only fields.
+ */
+
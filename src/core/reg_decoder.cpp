@@ -0,0 +1,260 @@
+/*
+ * Headless decoder of register arrays into field values.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_decoder.hpp"
+
+#include <map>
+
+#include "reg_validator.hpp"
+
+static inline QString hex_string(uint64_t value)
+{
+    return QString::asprintf("0x%lx", value);
+}
+
+QString field_value_label(const RegField &field, uint64_t bits_value)
+{
+    switch (field.desc_type)
+    {
+    case BITS_ITEM_DESC_ENUM:
+        {
+            int index = field.enum_def->index_of(bits_value);
+
+            return (index < 0) ? QString() : field.enum_def->labels[index];
+        }
+
+    case BITS_ITEM_DESC_BOOL:
+        return bits_value ? "true" : "false";
+
+    case BITS_ITEM_DESC_INVBOOL:
+        return bits_value ? "false" : "true";
+
+    case BITS_ITEM_DESC_DECIMAL:
+        {
+            uint64_t sign_bit = u64_lshift(1, field.high - field.low);
+
+            if (bits_value & sign_bit)
+                return QString("-") + QString::number((~bits_value + 1) & field.max_value());
+
+            return QString::number(bits_value);
+        }
+
+    case BITS_ITEM_DESC_UDECIMAL:
+        return QString::number(bits_value);
+
+    default:
+        return QString();
+    }
+}
+
+RegDecoder::RegDecoder(const RegConfig &config, const QString &module_name, AddrBaseMethod method, uint64_t addr_base)
+    : m_config(config)
+    , m_module(module_name.isEmpty() ? nullptr : config.find_module(module_name))
+    , m_method(module_name.isEmpty() ? ADDR_BASE_GLOBAL : method)
+    , m_addr_base(addr_base)
+{
+    if (ADDR_BASE_GLOBAL != m_method)
+        return;
+
+    for (const auto &m : m_config.modules)
+    {
+        if (!m->has_base || 0 == m->size)
+            continue;
+
+        m_module_tree.insert(m->base, (m->size - 1 > UINT64_MAX - m->base) ? UINT64_MAX : (m->base + m->size - 1),
+            m.get());
+    }
+    m_module_tree.build();
+}
+
+const RegInfo* RegDecoder::find_register(uint64_t addr, const RegModule **module) const
+{
+    if (ADDR_BASE_GLOBAL != m_method)
+    {
+        uint64_t offset = apply_addr_base(addr, m_method, m_addr_base, 0);
+        const RegInfo *reg = m_module ? m_module->find_register(offset) : nullptr;
+
+        // Absolute addresses of the module need no rebasing, e.g.: in a dump of physical addresses.
+        if (nullptr == reg && m_module && m_module->has_base && addr >= m_module->base
+            && addr - m_module->base < m_module->size)
+        {
+            reg = m_module->find_register(addr - m_module->base);
+        }
+
+        *module = m_module;
+
+        return reg;
+    }
+
+    // The module found owns the address even if it has no such register, as SocAddrMap::find_register() does.
+    const auto *interval = m_module_tree.find(addr);
+    const RegInfo *reg = interval ? interval->data->find_register(addr - interval->data->base) : nullptr;
+
+    *module = reg ? interval->data : nullptr;
+
+    return reg;
+}
+
+QJsonObject RegDecoder::decode(uint64_t addr, uint64_t value) const
+{
+    const RegModule *module = nullptr;
+    const RegInfo *reg = this->find_register(addr, &module);
+    QJsonObject result({
+        { "addr", hex_string(addr) },
+        { "value", hex_string(value) },
+    });
+
+    if (nullptr == reg)
+    {
+        result.insert("error", "No such a register");
+
+        return result;
+    }
+
+    QJsonArray fields;
+
+    for (const auto &field : reg->fields)
+    {
+        uint64_t bits_value = field.extract(value);
+        QJsonObject item({
+            { "bits", field.range },
+            { "name", field.name() },
+            { "value", hex_string(bits_value) },
+            { "ro", field.readonly },
+        });
+        const QString &label = field_value_label(field, bits_value);
+
+        if (!label.isEmpty())
+            item.insert("label", label);
+
+        fields.append(item);
+    }
+
+    std::vector<RegIssue> issues;
+
+    result.insert("module", module->name);
+    result.insert("register", reg->key);
+    result.insert("fields", fields);
+    if (validate_register_value(*reg, value, 0, issues) > 0)
+    {
+        QJsonArray issue_texts;
+
+        for (const auto &issue : issues)
+        {
+            issue_texts.append(reg_issue_text(issue));
+        }
+        result.insert("issues", issue_texts);
+    }
+
+    return result;
+}
+
+QJsonArray RegDecoder::decode(const std::vector<RegArrayItem> &items) const
+{
+    QJsonArray result;
+
+    for (const auto &item : items)
+    {
+        result.append(this->decode(item.addr, item.value));
+    }
+
+    return result;
+}
+
+QJsonArray RegDecoder::diff(const std::vector<RegArrayItem> &old_items, const std::vector<RegArrayItem> &new_items) const
+{
+    std::map<uint64_t, std::pair<const uint64_t *, const uint64_t *>> pairs; // addr => (old, new), the last one wins
+    QJsonArray result;
+
+    for (const auto &item : old_items)
+    {
+        pairs[item.addr].first = &item.value;
+    }
+
+    for (const auto &item : new_items)
+    {
+        pairs[item.addr].second = &item.value;
+    }
+
+    for (const auto &p : pairs)
+    {
+        const uint64_t *old_value = p.second.first;
+        const uint64_t *new_value = p.second.second;
+
+        if (old_value && new_value && *old_value == *new_value)
+            continue;
+
+        const RegModule *module = nullptr;
+        const RegInfo *reg = this->find_register(p.first, &module);
+        QJsonObject item({ { "addr", hex_string(p.first) } });
+
+        if (old_value)
+            item.insert("old", hex_string(*old_value));
+
+        if (new_value)
+            item.insert("new", hex_string(*new_value));
+
+        if (reg)
+        {
+            QJsonArray fields;
+
+            item.insert("module", module->name);
+            item.insert("register", reg->key);
+            for (const auto &field : reg->fields)
+            {
+                uint64_t old_bits = old_value ? field.extract(*old_value) : 0;
+                uint64_t new_bits = new_value ? field.extract(*new_value) : 0;
+
+                if (old_value && new_value && old_bits == new_bits)
+                    continue;
+
+                QJsonObject field_item({ { "bits", field.range }, { "name", field.name() } });
+
+                if (old_value)
+                    field_item.insert("old", hex_string(old_bits));
+
+                if (new_value)
+                    field_item.insert("new", hex_string(new_bits));
+
+                fields.append(field_item);
+            }
+            item.insert("fields", fields);
+        }
+
+        result.append(item);
+    } // for (p : pairs)
+
+    return result;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Report issues found by validate_register_value() in decoding results.
+ *  03. Look up enum labels via shared enum definitions.
+ *  04. Access compiled modules via shared pointers.
+ *  05. Look up modules by absolute addresses via an interval tree built once,
+ *      which honors "__size__" of modules.
+ *  06. Fall back to absolute addresses of the named module if not found as offsets,
+ *      instead of leaving it to the GUI, so that validation resolves them as well.
+ */
+
@@ -0,0 +1,104 @@
+/*
+ * Headless decoder of register arrays into field values.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_DECODER_HPP__
+#define __REG_DECODER_HPP__
+
+#include <stdint.h>
+
+#include <vector>
+
+#include <QString>
+#include <QJsonObject>
+#include <QJsonArray>
+
+#include "reg_schema.hpp"
+#include "reg_codec.hpp"
+#include "soc_map.hpp"
+
+// e.g.: "4 data lanes(ALL)" for enum, "true" for bool, "-3" for decimal, or empty if not applicable.
+QString field_value_label(const RegField &field, uint64_t bits_value);
+
+class RegDecoder
+{
+public:
+    RegDecoder() = delete;
+
+    /*
+     * All modules with "__base__" are looked up by absolute addresses if module_name is empty,
+     * within their "__size__" and the same way as SocAddrMap if any of them overlap.
+     * Otherwise, absolute addresses within "__base__" and "__size__" of the named module
+     * are looked up without rebasing as well, if they are not offsets of it after rebasing.
+     */
+    RegDecoder(const RegConfig &config, const QString &module_name, AddrBaseMethod method, uint64_t addr_base);
+
+public:
+    inline bool valid(void) const
+    {
+        return (ADDR_BASE_GLOBAL == m_method || nullptr != m_module);
+    }
+
+    const RegInfo* find_register(uint64_t addr, const RegModule **module) const;
+
+    /*
+     * {
+     *   "addr": "0x0004", "value": "0x00000003", "module": "MIPI CSI HOST", "register": "0x0004 | N_LANES",
+     *   "fields": [ { "bits": "1:0", "name": "n_lanes", "value": "0x3", "label": "4 data lanes(ALL)", "ro": false }, ... ],
+     *   "issues": [ "n_lanes[1:0]: illegal value 0x2", ... ] // present only if any, see reg_validator.hpp
+     * }
+     *
+     * or { "addr": "0x0004", "value": "0x00000003", "error": "..." } if no register matches.
+     */
+    QJsonObject decode(uint64_t addr, uint64_t value) const;
+
+    QJsonArray decode(const std::vector<RegArrayItem> &items) const;
+
+    /*
+     * Only registers with different values are listed, each of which is like:
+     *
+     * {
+     *   "addr": "0x0004", "old": "0x00000001", "new": "0x00000003", "register": "0x0004 | N_LANES",
+     *   "fields": [ { "bits": "1:0", "name": "n_lanes", "old": "0x1", "new": "0x3" }, ... ]
+     * }
+     *
+     * in which "old" or "new" is absent if the register is missing in the corresponding side.
+     */
+    QJsonArray diff(const std::vector<RegArrayItem> &old_items, const std::vector<RegArrayItem> &new_items) const;
+
+private:
+    const RegConfig &m_config;
+    const RegModule *m_module;
+    AddrBaseMethod m_method;
+    uint64_t m_addr_base;
+    IntervalTree<const RegModule *> m_module_tree; // built for ADDR_BASE_GLOBAL only
+};
+
+#endif /* #ifndef __REG_DECODER_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Add "issues" to decoding results.
+ *  03. Look up modules by absolute addresses via an interval tree.
+ *  04. Fall back to absolute addresses of the named module.
+ */
+
@@ -0,0 +1,339 @@
+/*
+ * Headless encoder of register arrays from field assignments.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_encoder.hpp"
+
+#include <errno.h>
+#include <stdio.h>
+
+#include <QFile>
+#include <QStringList>
+
+#include "qt_print.hpp"
+
+// Returns the position of the first c outside of double quotes, or -1 if not found.
+static int find_unquoted(const QString &text, QChar c)
+{
+    bool quoted = false;
+
+    for (int i = 0; i < text.size(); ++i)
+    {
+        if ('"' == text[i])
+            quoted = !quoted;
+        else if (!quoted && c == text[i])
+            return i;
+        else
+        {
+            ; // nothing but for the sake of Code of Conduct
+        }
+    }
+
+    return -1;
+}
+
+static QString unquote(const QString &text)
+{
+    const QString &result = text.trimmed();
+
+    return (result.size() >= 2 && result.startsWith('"') && result.endsWith('"'))
+        ? result.mid(1, result.size() - 2) : result;
+}
+
+static QStringList split_path(const QString &path)
+{
+    QStringList result;
+    QString rest(path);
+    int pos;
+
+    while ((pos = find_unquoted(rest, '.')) >= 0)
+    {
+        result << unquote(rest.left(pos));
+        rest.remove(0, pos + 1);
+    }
+    result << unquote(rest);
+
+    return result;
+}
+
+static bool parse_integer(const QString &text, uint64_t &value)
+{
+    const std::string &str = text.trimmed().toStdString();
+    bool is_hex = (0 == str.compare(0, 2, "0x") || 0 == str.compare(0, 2, "0X"));
+    char *end_ptr;
+
+    if (str.empty() || '-' == str[0])
+        return false;
+
+    value = strtoull(str.c_str(), &end_ptr, is_hex ? 16 : 10);
+
+    return (end_ptr != str.c_str() + (is_hex ? 2 : 0) && '\0' == *end_ptr);
+}
+
+static int parse_field_value(const RegField &field, const QString &text, uint64_t &value, QString *err_msg)
+{
+    const QString &trimmed_text = text.trimmed();
+    bool quoted = (trimmed_text.size() >= 2 && trimmed_text.startsWith('"') && trimmed_text.endsWith('"'));
+
+    if (!quoted && parse_integer(trimmed_text, value))
+    {
+        if (value > field.max_value())
+        {
+            *err_msg = QString::asprintf("Value 0x%lx exceeds bits[", value) + field.range + "]";
+
+            return -ERANGE;
+        }
+
+        return 0;
+    }
+
+    if (!quoted && BITS_ITEM_DESC_DECIMAL == field.desc_type && trimmed_text.startsWith('-')
+        && parse_integer(trimmed_text.mid(1), value))
+    {
+        uint64_t sign_bit = u64_lshift(1, field.high - field.low);
+
+        if (value > sign_bit)
+        {
+            *err_msg = trimmed_text + " exceeds signed range of bits[" + field.range + "]";
+
+            return -ERANGE;
+        }
+
+        value = (~value + 1) & field.max_value();
+
+        return 0;
+    }
+
+    int index = field.enum_def ? field.enum_def->find_label(unquote(trimmed_text)) : -1;
+
+    if (index >= 0 && index != field.enum_def->others_index) // "Others" is not a concrete value
+    {
+        value = field.enum_def->values[index];
+
+        return 0;
+    }
+
+    *err_msg = QString("Invalid value for field[") + field.name() + "]: " + trimmed_text;
+
+    return -EINVAL;
+}
+
+int RegEncoder::assign(const QString &statement, QString *err_msg)
+{
+    QString stmt = statement.trimmed();
+    QString err;
+
+    if (nullptr == err_msg)
+        err_msg = &err;
+
+    if (stmt.isEmpty() || stmt.startsWith('#') || stmt.startsWith("//"))
+        return 0;
+
+    if (stmt.endsWith(';') || stmt.endsWith(','))
+        stmt.chop(1);
+
+    int eq_pos = find_unquoted(stmt, '=');
+
+    if (eq_pos < 0)
+    {
+        *err_msg = "Missing \"=\" in statement: " + stmt;
+
+        return -EINVAL;
+    }
+
+    const QStringList &path = split_path(stmt.left(eq_pos));
+    const QString &value_text = stmt.mid(eq_pos + 1);
+
+    if (path.size() < 2 || path.size() > 3)
+    {
+        *err_msg = "Path must be MODULE.REGISTER[.FIELD]: " + stmt.left(eq_pos).trimmed();
+
+        return -EINVAL;
+    }
+
+    const RegModule *module = m_config.find_module(path[0]);
+
+    if (nullptr == module)
+    {
+        *err_msg = "Cannot find module: " + path[0];
+
+        return -ENOENT;
+    }
+
+    const RegInfo *reg = module->find_register(path[1]);
+
+    if (nullptr == reg)
+    {
+        *err_msg = "Cannot find register[" + path[1] + "] in module: " + path[0];
+
+        return -ENOENT;
+    }
+
+    auto key = std::make_pair(static_cast<size_t>(m_config.index_of(module)), reg->offset);
+    auto iter = m_values.find(key);
+    uint64_t full_value = (m_values.end() == iter) ? reg->default_value : iter->second;
+    uint64_t value = 0;
+
+    if (2 == path.size())
+    {
+        uint64_t max_value = gen_bits_mask(m_config.data_bits - 1, 0);
+
+        if (!parse_integer(value_text, value))
+        {
+            *err_msg = "Invalid value for register[" + reg->name + "]: " + value_text.trimmed();
+
+            return -EINVAL;
+        }
+
+        if (value > max_value)
+        {
+            *err_msg = QString::asprintf("Value 0x%lx exceeds %d data bits of register[", value, m_config.data_bits)
+                + reg->name + "]";
+
+            return -ERANGE;
+        }
+
+        full_value = value;
+    }
+    else
+    {
+        const RegField *field = reg->find_field(path[2]);
+        int ret;
+
+        if (nullptr == field)
+        {
+            *err_msg = "Cannot find field[" + path[2] + "] in register: " + reg->name;
+
+            return -ENOENT;
+        }
+
+        if (BITS_ITEM_DESC_RESERVED == field->desc_type)
+        {
+            *err_msg = "Bits[" + field->range + "] of register[" + reg->name + "] are reserved";
+
+            return -EPERM;
+        }
+
+        if ((ret = parse_field_value(*field, value_text, value, err_msg)) < 0)
+            return ret;
+
+        if (field->readonly)
+        {
+            qtCWarnV(::, "%s.%s.%s is read-only, assigned anyway.", module->name.toStdString().c_str(),
+                reg->name.toStdString().c_str(), field->name().toStdString().c_str());
+        }
+
+        full_value = field->merge(full_value, value);
+    }
+
+    m_values[key] = full_value;
+
+    return 0;
+}
+
+int RegEncoder::load(const QString &path)
+{
+    QFile file;
+    bool is_stdin = ("-" == path);
+
+    if (is_stdin)
+        file.open(stdin, QIODevice::ReadOnly | QIODevice::Text);
+    else
+    {
+        file.setFileName(path);
+        file.open(QIODevice::ReadOnly | QIODevice::Text);
+    }
+
+    if (!file.isOpen())
+    {
+        qtCErrV(::, "Failed to read file: %s, reason: %s",
+            path.toStdString().c_str(), file.errorString().toStdString().c_str());
+
+        return -EIO;
+    }
+
+    int line_num = 0;
+    int fail_count = 0;
+    QString err_msg;
+
+    while (!file.atEnd())
+    {
+        const QString &line = QString::fromUtf8(file.readLine());
+
+        ++line_num;
+        if (this->assign(line, &err_msg) < 0)
+        {
+            qtCErrV(::, "%s:%d: %s", (is_stdin ? "<stdin>" : path.toStdString().c_str()), line_num,
+                err_msg.toStdString().c_str());
+            ++fail_count;
+        }
+    }
+
+    return fail_count;
+}
+
+QString RegEncoder::generate(int delim_index, AddrBaseMethod method, uint64_t addr_base) const
+{
+    const char *addr_width_fmt = bitwidth_format_string(m_config.addr_bits);
+    const char *value_width_fmt = bitwidth_format_string(m_config.data_bits);
+    QString result;
+
+    for (const auto &item : m_values)
+    {
+        const RegModule &module = *m_config.modules[item.first.first];
+
+        if (ADDR_BASE_GLOBAL == method && !module.has_base)
+        {
+            qtCWarnV(::, "Module[%s] has no __base__, offset 0x%lx output as is.",
+                module.name.toStdString().c_str(), item.first.second);
+        }
+
+        uint64_t addr = apply_addr_base(item.first.second, method, addr_base, module.base);
+
+        append_register_array_item(result, delim_index, addr_width_fmt, value_width_fmt, addr, item.second);
+    }
+
+    return result;
+}
+
+std::vector<RegArrayItem> RegEncoder::module_items(size_t module_index, AddrBaseMethod method,
+    uint64_t addr_base) const
+{
+    const RegModule &module = *m_config.modules[module_index];
+    std::vector<RegArrayItem> items;
+
+    for (auto iter = m_values.lower_bound({ module_index, 0 });
+        m_values.end() != iter && iter->first.first == module_index; ++iter)
+    {
+        items.push_back({ apply_addr_base(iter->first.second, method, addr_base, module.base), iter->second });
+    }
+
+    return items;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Look up enum and bool labels via shared enum definitions.
+ *  03. Add module_items().
+ *  04. Access compiled modules via shared pointers.
+ */
+
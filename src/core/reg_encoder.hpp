@@ -0,0 +1,96 @@
+/*
+ * Headless encoder of register arrays from field assignments.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_ENCODER_HPP__
+#define __REG_ENCODER_HPP__
+
+#include <stdint.h>
+
+#include <vector>
+#include <map>
+
+#include <QString>
+
+#include "reg_schema.hpp"
+#include "reg_codec.hpp"
+
+/*
+ * Assignment statements, one per line:
+ *
+ *   "MIPI CSI HOST".N_LANES.n_lanes = 3
+ *   "MIPI CSI HOST".CSI2_RESETN.csi2_resetn = "false"
+ *   "MIPI CSI HOST".0x0040 = 0x0C204001
+ *
+ * A path consists of module, register and optional field, separated by dots,
+ * each of which can be double-quoted if it contains dots or spaces.
+ * A register is matched by its name, its key or its offset, and a field by its name or bits range.
+ * A value is an integer (hexadecimal with "0x" prefix, or decimal), or a label of enum/bool/invbool field.
+ * Empty lines and lines starting with "#" or "//" are ignored.
+ *
+ * Each register starts from its default value in "__defaults__" the first time it is touched.
+ */
+class RegEncoder
+{
+public:
+    RegEncoder() = delete;
+
+    explicit RegEncoder(const RegConfig &config)
+        : m_config(config)
+    {
+    }
+
+public:
+    inline void reset(void)
+    {
+        m_values.clear();
+    }
+
+    inline size_t count(void) const
+    {
+        return m_values.size();
+    }
+
+    // Returns 0 on success, or a negative errno with err_msg filled.
+    int assign(const QString &statement, QString *err_msg);
+
+    // Returns the number of failed statements, each of which is logged, or a negative errno on I/O error.
+    int load(const QString &path);
+
+    // Generates register array items, modules in the order of "__modules__", registers in the order of offsets.
+    QString generate(int delim_index, AddrBaseMethod method, uint64_t addr_base) const;
+
+    // Items of the module at module_index of configuration only, in the order of offsets.
+    std::vector<RegArrayItem> module_items(size_t module_index, AddrBaseMethod method, uint64_t addr_base) const;
+
+private:
+    const RegConfig &m_config;
+    std::map<std::pair<size_t, uint64_t>, uint64_t> m_values; // (index of module, offset) => full value
+};
+
+#endif /* #ifndef __REG_ENCODER_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Add module_items() for generators of other formats.
+ */
+
@@ -0,0 +1,73 @@
+/*
+ * Filter of registers to show, evaluated on compiled schemas.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_filter.hpp"
+
+static bool contains_text(const RegInfo *reg, const QString &reg_key, const QString &text)
+{
+    if (reg_key.contains(text, Qt::CaseInsensitive))
+        return true;
+
+    if (nullptr == reg)
+        return false;
+
+    for (const auto &field : reg->fields)
+    {
+        if (field.title.contains(text, Qt::CaseInsensitive) || field.hint.contains(text, Qt::CaseInsensitive))
+            return true;
+    }
+
+    return false;
+}
+
+bool RegFilter::accepts(const RegInfo *reg, const QString &reg_key, uint64_t default_value, uint64_t value,
+    bool flagged) const
+{
+    bool passed;
+
+    switch (mode)
+    {
+    case REG_FILTER_CHANGED:
+        passed = (value != default_value);
+        break;
+
+    case REG_FILTER_WRITABLE:
+        passed = (nullptr == reg || 0 != reg->rw_mask);
+        break;
+
+    case REG_FILTER_FLAGGED:
+        passed = flagged;
+        break;
+
+    default:
+        passed = true;
+        break;
+    }
+
+    return passed && (text.isEmpty() || contains_text(reg, reg_key, text));
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
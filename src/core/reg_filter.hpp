@@ -0,0 +1,68 @@
+/*
+ * Filter of registers to show, evaluated on compiled schemas.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_FILTER_HPP__
+#define __REG_FILTER_HPP__
+
+#include <stdint.h>
+
+#include <QString>
+
+#include "reg_schema.hpp"
+
+enum RegFilterMode
+{
+    REG_FILTER_ALL,
+    REG_FILTER_CHANGED, // value differs from the default one
+    REG_FILTER_WRITABLE, // having any writable bits
+    REG_FILTER_FLAGGED, // flagged by validation
+};
+
+/*
+ * Evaluated on compiled registers and raw values before any widget is made,
+ * so that filtered-out registers cost nothing in the view.
+ */
+struct RegFilter
+{
+    RegFilterMode mode;
+    QString text; // to be contained case-insensitively by the key, names or hints of fields, ignored if empty
+
+    inline bool empty(void) const
+    {
+        return REG_FILTER_ALL == mode && text.isEmpty();
+    }
+
+    /*
+     * reg is nullptr if the register is not in the compiled configuration, e.g.: one of another file
+     * looked up via the SoC map, in which case it's taken as writable and only its key is matched against text.
+     */
+    bool accepts(const RegInfo *reg, const QString &reg_key, uint64_t default_value, uint64_t value,
+        bool flagged) const;
+};
+
+#endif /* #ifndef __REG_FILTER_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,113 @@
+/*
+ * Undo/redo journal of register edits.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_journal.hpp"
+
+RegEditJournal::RegEditJournal(size_t capacity/* = DEFAULT_CAPACITY */)
+    : m_ring((capacity > 0) ? capacity : DEFAULT_CAPACITY)
+    , m_begin(0)
+    , m_cursor(0)
+    , m_end(0)
+    , m_group_depth(0)
+    , m_group_empty(true)
+{
+}
+
+void RegEditJournal::begin_group(void)
+{
+    if (0 == m_group_depth++)
+        m_group_empty = true;
+}
+
+void RegEditJournal::end_group(void)
+{
+    if (m_group_depth > 0)
+        --m_group_depth;
+}
+
+void RegEditJournal::record(uint32_t reg_id, uint16_t field_index, uint64_t old_bits, uint64_t new_bits)
+{
+    if (old_bits == new_bits)
+        return;
+
+    bool group_head = (0 == m_group_depth || m_group_empty);
+
+    m_end = m_cursor;
+
+    // The oldest operation is dropped as a whole, or it would be undone partially.
+    if (m_end - m_begin >= m_ring.size())
+    {
+        do
+        {
+            ++m_begin;
+        }
+        while (m_begin < m_end && !this->at(m_begin).group_head);
+    }
+
+    this->at(m_end++) = { reg_id, field_index, static_cast<uint16_t>(group_head ? 1 : 0), old_bits, new_bits };
+    m_cursor = m_end;
+    m_group_empty = false;
+}
+
+size_t RegEditJournal::undo(std::vector<Entry> &deltas)
+{
+    deltas.clear();
+
+    while (m_cursor > m_begin)
+    {
+        const Entry &entry = this->at(--m_cursor);
+
+        deltas.push_back(entry);
+        if (entry.group_head)
+            break;
+    }
+
+    return deltas.size();
+}
+
+size_t RegEditJournal::redo(std::vector<Entry> &deltas)
+{
+    deltas.clear();
+
+    if (m_cursor >= m_end)
+        return 0;
+
+    deltas.push_back(this->at(m_cursor++));
+    while (m_cursor < m_end && !this->at(m_cursor).group_head)
+    {
+        deltas.push_back(this->at(m_cursor++));
+    }
+
+    return deltas.size();
+}
+
+void RegEditJournal::clear(void)
+{
+    m_begin = m_cursor = m_end = 0;
+    m_group_empty = true;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,106 @@
+/*
+ * Undo/redo journal of register edits.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_JOURNAL_HPP__
+#define __REG_JOURNAL_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+/*
+ * Per-field deltas are kept as fixed-size entries in a ring buffer, and the oldest operations
+ * are dropped as a whole once it's full. Entries recorded between begin_group() and end_group()
+ * make up one operation, which is undone or redone in one step.
+ * Registers are identified by whatever ids the user of journal assigns, e.g.: indexes of tables.
+ */
+class RegEditJournal
+{
+public:
+    static const size_t DEFAULT_CAPACITY = 4096;
+
+    struct Entry
+    {
+        uint32_t reg_id;
+        uint16_t field_index;
+        uint16_t group_head; // 1 for the first entry of an operation, 0 for the rest
+        uint64_t old_bits;
+        uint64_t new_bits;
+    };
+
+    explicit RegEditJournal(size_t capacity = DEFAULT_CAPACITY);
+
+public:
+    // Groups may be nested, and only the outermost one makes an operation.
+    void begin_group(void);
+    void end_group(void);
+
+    // Drops all undone operations which are not redone yet. Nothing is recorded if old_bits equals new_bits.
+    void record(uint32_t reg_id, uint16_t field_index, uint64_t old_bits, uint64_t new_bits);
+
+    // Fetches entries of the last operation in reverse order, whose old_bits are to be applied.
+    size_t undo(std::vector<Entry> &deltas);
+
+    // Fetches entries of the next undone operation in order, whose new_bits are to be applied.
+    size_t redo(std::vector<Entry> &deltas);
+
+    void clear(void);
+
+    inline bool can_undo(void) const
+    {
+        return m_cursor > m_begin;
+    }
+
+    inline bool can_redo(void) const
+    {
+        return m_end > m_cursor;
+    }
+
+    inline size_t size(void) const // including undone entries
+    {
+        return m_end - m_begin;
+    }
+
+private:
+    inline Entry& at(uint64_t seq)
+    {
+        return m_ring[seq % m_ring.size()];
+    }
+
+private:
+    std::vector<Entry> m_ring;
+    // Sequence numbers of entries, which never wrap around in practice.
+    uint64_t m_begin; // the oldest one
+    uint64_t m_cursor; // next to the last one applied
+    uint64_t m_end; // next to the newest one
+    int m_group_depth;
+    bool m_group_empty; // no entries recorded yet since the outermost begin_group()
+};
+
+#endif /* #ifndef __REG_JOURNAL_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
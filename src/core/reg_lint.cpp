@@ -0,0 +1,430 @@
+/*
+ * Lint of configuration files, checked in parallel across files.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_lint.hpp"
+
+#include <errno.h>
+
+#include <map>
+#include <set>
+#include <algorithm>
+
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+#include "qt_print.hpp"
+#include "reg_schema.hpp"
+#include "reg_archive.hpp"
+#include "work_pool.hpp"
+
+RegConfigLinter::RegConfigLinter(const QString &config_dir)
+    : m_config_dir(config_dir)
+{
+}
+
+int RegConfigLinter::collect_files(const QString &config_dir, std::vector<QString> &rel_paths)
+{
+    const RegConfigArchive *archive = mounted_reg_archive();
+
+    rel_paths.clear();
+    if (archive && archive->path() == config_dir)
+    {
+        for (const auto &entry : archive->entries())
+        {
+            rel_paths.push_back(entry.path);
+        }
+
+        return 0;
+    }
+
+    auto dir_filters = QDir::Filter::Dirs | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
+    auto file_filters = QDir::Filter::Files | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
+    auto sort_flags = QDir::SortFlag::Name;
+    QDir dir(config_dir);
+
+    if (!dir.exists())
+        return -ENOENT;
+
+    for (const QString &vendor : dir.entryList(dir_filters, sort_flags))
+    {
+        QDir vdir(dir.filePath(vendor));
+
+        for (const QString &chip : vdir.entryList(dir_filters, sort_flags))
+        {
+            QDir cdir(vdir.filePath(chip));
+
+            for (const QString &file_name : cdir.entryList(file_filters, sort_flags))
+            {
+                rel_paths.push_back(vendor + "/" + chip + "/" + file_name);
+            }
+        }
+    }
+
+    return 0;
+}
+
+int RegConfigLinter::run(const std::vector<QString> &paths, int worker_count)
+{
+    WorkStealingPool pool(worker_count);
+    int fail_count = 0;
+
+    m_paths = paths;
+    m_issues.assign(paths.size(), std::vector<Issue>());
+    m_abs_addrs.assign(paths.size(), AddrOwners());
+
+    // Each file has a slot of its own, so no lock is needed.
+    pool.run(paths.size(), [this](size_t task_index, int /* worker_index */) {
+        const QString &path = m_paths[task_index];
+
+        lint_file(path.startsWith('/') ? path : (m_config_dir + "/" + path), m_issues[task_index],
+            m_abs_addrs[task_index]);
+    });
+
+    this->check_chip_addresses();
+
+    for (const auto &issues : m_issues)
+    {
+        if (!issues.empty())
+            ++fail_count;
+    }
+
+    return fail_count;
+}
+
+QJsonObject RegConfigLinter::report(void) const
+{
+    QJsonArray issue_list;
+    int fail_count = 0;
+
+    for (size_t i = 0; i < m_issues.size(); ++i)
+    {
+        if (!m_issues[i].empty())
+            ++fail_count;
+
+        for (const auto &issue : m_issues[i])
+        {
+            QJsonObject item;
+
+            item.insert("file", m_paths[i]);
+            if (!issue.module.isEmpty())
+                item.insert("module", issue.module);
+            if (!issue.reg_key.isEmpty())
+                item.insert("register", issue.reg_key);
+            item.insert("check", issue.check);
+            if (issue.bits)
+                item.insert("bits", QString::asprintf("0x%lx", issue.bits));
+            item.insert("message", issue.message);
+
+            issue_list.append(item);
+        }
+    }
+
+    QJsonObject result;
+
+    result.insert("files", static_cast<qint64>(m_paths.size()));
+    result.insert("failed", fail_count);
+    result.insert("issues", issue_list);
+
+    return result;
+}
+
+// Modules placed by different files of a chip share one address space, see SocAddrMap.
+void RegConfigLinter::check_chip_addresses(void)
+{
+    // chip directory => absolute address => index of file and the first register at it
+    std::map<QString, std::map<uint64_t, std::pair<size_t, const AddrOwner *>>> chips;
+
+    for (size_t i = 0; i < m_paths.size(); ++i)
+    {
+        auto &chip_owners = chips[m_paths[i].section('/', 0, -2)];
+
+        for (const auto &a : m_abs_addrs[i])
+        {
+            auto result = chip_owners.insert({ a.first, { i, &a.second } });
+            const auto &owner = result.first->second;
+
+            // Duplicates within a file are reported by lint_file() already.
+            if (result.second || a.second.waived)
+                continue;
+
+            m_issues[i].push_back({ a.second.module, a.second.reg_key, "address", 0,
+                QString::asprintf("Duplicate absolute address 0x%lx with register: ", a.first)
+                    + m_paths[owner.first] + ": " + owner.second->module + "/" + owner.second->reg_key });
+        }
+    }
+}
+
+size_t RegConfigLinter::issue_count(void) const
+{
+    size_t count = 0;
+
+    for (const auto &issues : m_issues)
+    {
+        count += issues.size();
+    }
+
+    return count;
+}
+
+static bool has_ref_item(const QJsonArray &items)
+{
+    for (const QJsonValue &item : items)
+    {
+        if (item.isObject() && item.toObject().contains("ref"))
+            return true;
+    }
+
+    return false;
+}
+
+static bool is_waived(const QJsonObject &modules_dict, const char *check, const QString &reg_key)
+{
+    for (const QJsonValue &key : modules_dict.value("__lint_ignore__").toObject().value(check).toArray())
+    {
+        if ("*" == key.toString() || reg_key == key.toString())
+            return true;
+    }
+
+    return false;
+}
+
+// Returns the reason if the "ref" of a register can't be resolved, or an empty string otherwise.
+static QString check_ref(const QJsonObject &modules_dict, const QJsonArray &items)
+{
+    for (const QJsonValue &item : items)
+    {
+        if (!item.isObject() || !item.toObject().contains("ref"))
+            continue;
+
+        const QJsonValue &ref_val = item.toObject().value("ref");
+
+        if (!ref_val.isString())
+            return "Value of \"ref\" property is not a string!";
+
+        const QString &ref_key = ref_val.toString();
+        const QJsonValue &target = modules_dict.value(ref_key);
+
+        if (target.isUndefined())
+            return QString("No such register to reference: ") + ref_key;
+
+        if (!target.isArray())
+            return QString("Referenced register is not an array: ") + ref_key;
+
+        if (has_ref_item(target.toArray()))
+            return QString("Referenced register references another one in turn: ") + ref_key;
+
+        break; // Only the first one takes effect, see find_referenced_register_if_any().
+    }
+
+    return QString();
+}
+
+void RegConfigLinter::lint_file(const QString &path, std::vector<Issue> &issues, AddrOwners &abs_addrs)
+{
+    QJsonDocument doc;
+    QString err_msg;
+
+    if (read_reg_config_doc(path, doc, &err_msg) < 0 || check_reg_config(doc.object(), &err_msg) < 0)
+    {
+        issues.push_back({ QString(), QString(), "load", 0, err_msg });
+
+        return;
+    }
+
+    const QJsonObject &doc_dict = doc.object();
+
+    for (const char *key : { "__addr_bits__", "__data_bits__" })
+    {
+        const QJsonValue &width_val = doc_dict.value(key);
+        int width = width_val.isDouble() ? width_val.toInt() : width_val.toString().toInt();
+
+        // Invalid ones fall back to the default silently on loading.
+        if (!width_val.isUndefined() && width != get_bitwidth(doc_dict, key))
+            issues.push_back({ QString(), QString(), "schema", 0, QString(key) + " is not one of 8, 16, 32 and 64!" });
+    }
+
+    int data_bits = get_bitwidth(doc_dict, "__data_bits__");
+    uint64_t data_mask = gen_bits_mask(data_bits - 1, 0);
+
+    abs_addrs.clear();
+    for (const auto &m : doc_dict.value("__modules__").toArray())
+    {
+        const QString &module_name = m.toString();
+        const QJsonObject &modules_dict = doc_dict.value(module_name).toObject();
+        std::set<QString> dangling_keys; // of registers with unresolved "ref"
+        size_t first_issue = issues.size();
+
+        for (auto iter = modules_dict.begin(); modules_dict.end() != iter; ++iter)
+        {
+            if (iter.key().startsWith("__") || !iter.value().isArray())
+                continue;
+
+            const QString &reason = check_ref(modules_dict, iter.value().toArray());
+
+            if (!reason.isEmpty())
+            {
+                issues.push_back({ module_name, iter.key(), "ref", 0, reason });
+                dangling_keys.insert(iter.key());
+            }
+        }
+
+        RegModule module;
+        QStringList errors;
+
+        compile_reg_module(modules_dict, module_name, module, data_bits, &errors);
+        for (const QString &err : errors)
+        {
+            bool dangling = false;
+
+            // Items of registers with unresolved "ref" are reported as a "ref" issue already.
+            for (const QString &key : dangling_keys)
+            {
+                if ((dangling = err.startsWith("reg[" + key + "]")))
+                    break;
+            }
+
+            if (!dangling)
+                issues.push_back({ module_name, QString(), "schema", 0, err });
+        }
+
+        const QJsonValue &defaults_val = modules_dict.value("__defaults__");
+        const QJsonObject &defaults_dict = defaults_val.toObject();
+
+        if (!defaults_val.isUndefined() && !defaults_val.isObject())
+            issues.push_back({ module_name, QString(), "schema", 0, "__defaults__ is not a dictionary/map!" });
+
+        const QJsonValue &ignore_val = modules_dict.value("__lint_ignore__");
+
+        if (!ignore_val.isUndefined() && !ignore_val.isObject())
+            issues.push_back({ module_name, QString(), "schema", 0, "__lint_ignore__ is not a dictionary/map!" });
+
+        for (auto iter = defaults_dict.begin(); defaults_dict.end() != iter; ++iter)
+        {
+            const std::string &val_str = iter.value().toString().toStdString();
+            char *end_ptr;
+
+            strtoull(val_str.c_str(), &end_ptr, 16);
+            if (iter.key().startsWith("__") || !modules_dict.value(iter.key()).isArray())
+                issues.push_back({ module_name, iter.key(), "default", 0, "Default value of a non-existent register" });
+            else if (end_ptr == val_str.c_str())
+                issues.push_back({ module_name, iter.key(), "default", 0, "Default value is not in hexadecimal" });
+            else
+            {
+                ; // nothing but for the sake of Code of Conduct
+            }
+        }
+
+        std::map<uint64_t, QString> offsets; // offset => register key
+
+        for (const auto &reg : module.registers)
+        {
+            const std::string &key_str = reg.key.toStdString();
+            char *end_ptr;
+
+            strtoull(key_str.c_str(), &end_ptr, 16);
+            if (end_ptr == key_str.c_str())
+                issues.push_back({ module_name, reg.key, "address", 0, "No offset in register key" });
+            else if (!offsets.insert({ reg.offset, reg.key }).second)
+            {
+                issues.push_back({ module_name, reg.key, "address", 0,
+                    QString::asprintf("Duplicate offset 0x%lx with register: ", reg.offset) + offsets[reg.offset] });
+            }
+            else if (module.has_base)
+            {
+                auto result = abs_addrs.insert({ module.base + reg.offset,
+                    { module_name, reg.key, is_waived(modules_dict, "address", reg.key) } });
+                const auto &owner = result.first->second;
+
+                if (!result.second && owner.module != module_name)
+                {
+                    issues.push_back({ module_name, reg.key, "address", 0,
+                        QString::asprintf("Duplicate absolute address 0x%lx with register: ", module.base + reg.offset)
+                            + owner.module + "/" + owner.reg_key });
+                }
+            }
+            else
+            {
+                ; // nothing but for the sake of Code of Conduct
+            }
+
+            if (dangling_keys.count(reg.key))
+                continue;
+
+            const QJsonArray &items = modules_dict.value(reg.ref_key.isEmpty() ? reg.key : reg.ref_key).toArray();
+
+            // Referenced items are checked along with the referenced register, and invalid ones as schema issues.
+            if (reg.ref_key.isEmpty() && (!reg.fields.empty() || items.isEmpty()))
+            {
+                uint64_t covered_mask = 0;
+
+                for (const auto &field : reg.fields)
+                {
+                    uint64_t mask = field.mask();
+
+                    if (mask & ~data_mask)
+                    {
+                        issues.push_back({ module_name, reg.key, "width", mask & ~data_mask,
+                            QString::asprintf("Bits range %s is beyond __data_bits__ (%d)",
+                                field.range.toStdString().c_str(), data_bits) });
+                    }
+
+                    if (mask & covered_mask)
+                    {
+                        issues.push_back({ module_name, reg.key, "overlap", mask & covered_mask,
+                            QString::asprintf("Bits range %s overlaps the ones before",
+                                field.range.toStdString().c_str()) });
+                    }
+
+                    covered_mask |= mask;
+                }
+
+                if (~covered_mask & data_mask)
+                {
+                    issues.push_back({ module_name, reg.key, "gap", ~covered_mask & data_mask,
+                        "Bits not covered by any item" });
+                }
+            }
+
+            // Uncovered bits are taken as reserved ones as well, see compute_reg_masks().
+            uint64_t bad_bits = reg.default_value & (reg.reserved_mask | ~data_mask);
+
+            if (bad_bits)
+            {
+                issues.push_back({ module_name, reg.key, "default", bad_bits,
+                    QString::asprintf("Default value 0x%lX has reserved bits set", reg.default_value) });
+            }
+        } // for (reg : module.registers)
+
+        issues.erase(std::remove_if(issues.begin() + first_issue, issues.end(), [&modules_dict](const Issue &issue) {
+            return is_waived(modules_dict, issue.check, issue.reg_key);
+        }), issues.end());
+    } // for (m : __modules__)
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Check duplicate absolute addresses among files of the same chip after the parallel pass.
+ *  03. Drop issues waived via "__lint_ignore__" of modules.
+ */
+
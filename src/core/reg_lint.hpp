@@ -0,0 +1,127 @@
+/*
+ * Lint of configuration files, checked in parallel across files.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_LINT_HPP__
+#define __REG_LINT_HPP__
+
+#include <stdint.h>
+
+#include <vector>
+#include <map>
+
+#include <QString>
+#include <QJsonObject>
+
+/*
+ * Each file is checked with inheritance resolved, and its modules are compiled anew
+ * to collect errors which are only logged on loading. Checks:
+ *
+ *   load:    failed to read, parse or inherit, or no valid "__modules__" array
+ *   schema:  invalid bit widths of file, or registers and bits items not in the required shape,
+ *            e.g.: invalid bits ranges, unknown description types, enums without "desc"
+ *   width:   bits beyond "__data_bits__"
+ *   overlap: bits covered by more than one item of a register
+ *   gap:     bits within "__data_bits__" covered by no item of a register
+ *   ref:     "ref" to a register which doesn't exist in the same module, or references another one in turn
+ *   address: register keys without offsets, or duplicate offsets within a module, or duplicate absolute
+ *            addresses among modules with "__base__", of the same file or of files of the same chip
+ *            (i.e.: in the same directory), which are merged after all files are checked in parallel
+ *   default: defaults with bits set in reserved fields, uncovered bits or bits beyond "__data_bits__",
+ *            or of registers which don't exist
+ *
+ * Checks can be waived for some registers of a module, or all of them via "*", e.g.:
+ *
+ *   "__lint_ignore__": { "default": [ "0x0000 | LANE_EN" ], "gap": [ "*" ] }
+ *
+ * Report format:
+ *
+ * {
+ *   "files": 12, "failed": 1,
+ *   "issues": [
+ *     {
+ *       "file": "rockchip/rk3588/mipi.json", "module": "MIPI CSI DPHY", "register": "0x0000 | LANE_EN",
+ *       "check": "default", "bits": "0x1", "message": "Default value 0x1 has reserved bits set"
+ *     }, ...
+ *   ]
+ * }
+ *
+ * where "failed" is the number of files with any issue, issues are grouped by file in the order given,
+ * and "module", "register" and "bits" (a mask of the offending bits) are present only if applicable.
+ */
+class RegConfigLinter
+{
+public:
+    RegConfigLinter() = delete;
+
+    // Relative paths are taken as relative to config_dir.
+    explicit RegConfigLinter(const QString &config_dir);
+
+public:
+    // Collects all files in the layout of "vendor/chip/file" of config_dir, or of the archive mounted in place of it.
+    static int collect_files(const QString &config_dir, std::vector<QString> &rel_paths);
+
+    // Returns the number of files with any issue.
+    int run(const std::vector<QString> &paths, int worker_count);
+
+    QJsonObject report(void) const;
+
+    size_t issue_count(void) const;
+
+private:
+    struct Issue
+    {
+        QString module;
+        QString reg_key;
+        const char *check;
+        uint64_t bits; // 0 if not applicable
+        QString message;
+    };
+
+    struct AddrOwner
+    {
+        QString module;
+        QString reg_key;
+        bool waived; // of the "address" check
+    };
+
+    typedef std::map<uint64_t, AddrOwner> AddrOwners; // absolute address => the first register at it
+
+    static void lint_file(const QString &path, std::vector<Issue> &issues, AddrOwners &abs_addrs);
+
+    void check_chip_addresses(void);
+
+private:
+    QString m_config_dir;
+    std::vector<QString> m_paths;
+    std::vector<std::vector<Issue>> m_issues; // per file
+    std::vector<AddrOwners> m_abs_addrs; // per file
+};
+
+#endif /* #ifndef __REG_LINT_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Check duplicate absolute addresses among files of the same chip as well.
+ *  03. Support waiving checks via "__lint_ignore__" of modules.
+ */
+
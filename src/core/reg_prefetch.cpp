@@ -0,0 +1,220 @@
+/*
+ * Speculative prefetcher of configuration files in background.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_prefetch.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "qt_print.hpp"
+#include "reg_archive.hpp"
+
+// Files inside the mounted archive are taken into account as well.
+static inline size_t file_cost(const QString &path)
+{
+    int64_t size = 0;
+    int64_t mtime = 0;
+
+    stat_reg_config_file(path, size, mtime);
+
+    return static_cast<size_t>(size) * RegConfigPrefetcher::COST_PER_FILE_BYTE;
+}
+
+RegConfigPrefetcher::RegConfigPrefetcher(size_t memory_cap)
+    : m_memory_cap(memory_cap)
+    , m_memory_usage(0)
+    , m_seq(0)
+    , m_stopping(false)
+{
+}
+
+RegConfigPrefetcher::~RegConfigPrefetcher()
+{
+    this->stop();
+}
+
+void RegConfigPrefetcher::set_memory_cap(size_t memory_cap)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_memory_cap = memory_cap;
+}
+
+void RegConfigPrefetcher::prefetch(const std::vector<QString> &paths)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (0 == m_memory_cap || m_stopping)
+            return;
+
+        m_queue.assign(paths.begin(), paths.end());
+    }
+
+    if (!m_worker.joinable())
+        m_worker = std::thread(&RegConfigPrefetcher::run, this);
+    else
+        m_cond.notify_one();
+}
+
+void RegConfigPrefetcher::put(const QString &path, const QJsonDocument &json, RegConfig &&config,
+    const RegConfigStamps &stamps)
+{
+    size_t cost = file_cost(path);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    this->insert(path, { json, std::move(config), stamps, cost, 0 });
+}
+
+bool RegConfigPrefetcher::take(const QString &path, QJsonDocument &json, RegConfig &config)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto iter = m_entries.find(path);
+
+    if (m_entries.end() == iter)
+        return false;
+
+    // The document and configuration are merged ones, which become stale on changes of base files as well.
+    bool fresh = reg_config_stamps_fresh(iter->second.stamps);
+
+    if (fresh)
+    {
+        json = iter->second.json;
+        config = std::move(iter->second.config);
+    }
+    m_memory_usage -= iter->second.cost;
+    m_entries.erase(iter);
+
+    return fresh;
+}
+
+void RegConfigPrefetcher::stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stopping = true;
+        m_queue.clear();
+    }
+    m_cond.notify_one();
+
+    if (m_worker.joinable())
+        m_worker.join();
+}
+
+size_t RegConfigPrefetcher::memory_usage(void) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_memory_usage;
+}
+
+void RegConfigPrefetcher::insert(const QString &path, Entry &&entry)
+{
+    auto iter = m_entries.find(path);
+
+    if (m_entries.end() != iter)
+    {
+        m_memory_usage -= iter->second.cost;
+        m_entries.erase(iter);
+    }
+
+    entry.seq = ++m_seq;
+    m_memory_usage += entry.cost;
+    m_entries.insert({ path, std::move(entry) });
+
+    while (m_memory_usage > m_memory_cap && m_entries.size() > 1)
+    {
+        auto oldest = m_entries.end();
+
+        for (auto i = m_entries.begin(); m_entries.end() != i; ++i)
+        {
+            if (i->first != path && (m_entries.end() == oldest || i->second.seq < oldest->second.seq))
+                oldest = i;
+        }
+
+        qtCDebugV(::, "Evicting prefetched file: %s", oldest->first.toStdString().c_str());
+        m_memory_usage -= oldest->second.cost;
+        m_entries.erase(oldest);
+    }
+}
+
+void RegConfigPrefetcher::run(void)
+{
+#ifdef __linux__
+    struct sched_param param = {};
+
+    // Only runs when CPUs are otherwise idle, so that it never competes with the GUI thread.
+    pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+#endif
+
+    while (true)
+    {
+        QString path;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_cond.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+            if (m_stopping)
+                break;
+
+            path = m_queue.front();
+            m_queue.pop_front();
+
+            auto iter = m_entries.find(path);
+
+            if (m_entries.end() != iter && reg_config_stamps_fresh(iter->second.stamps))
+                continue; // fetched already
+
+            if (file_cost(path) > m_memory_cap)
+                continue; // would evict everything else
+        }
+
+        // Loaded without holding the lock, so that take() is never blocked by it.
+        Entry entry = { QJsonDocument(), RegConfig(), RegConfigStamps(), 0, 0 };
+        QString err_msg;
+
+        if (load_reg_config(path, entry.config, &err_msg, &entry.json, &entry.stamps) < 0)
+        {
+            qtCDebugV(::, "Skipped prefetching: %s", err_msg.toStdString().c_str());
+            continue;
+        }
+        entry.cost = file_cost(path);
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        this->insert(path, std::move(entry));
+        qtCDebugV(::, "Prefetched: %s, memory usage: %lu/%lu", path.toStdString().c_str(),
+            m_memory_usage, m_memory_cap);
+    }
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Stat files via stat_reg_config_file() to support the mounted archive.
+ *  03. Take entries as stale on changes of files they inherit as well, via RegConfigStamps.
+ */
+
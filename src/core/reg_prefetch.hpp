@@ -0,0 +1,115 @@
+/*
+ * Speculative prefetcher of configuration files in background.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_PREFETCH_HPP__
+#define __REG_PREFETCH_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include <QString>
+#include <QJsonDocument>
+
+#include "reg_schema.hpp"
+
+/*
+ * Files are parsed and compiled one by one in a background thread of the lowest priority,
+ * and kept until taken, or evicted in the least-recently-fetched order once beyond the memory cap.
+ * The memory taken by a parsed document and its compiled configuration is estimated
+ * as a constant multiple of the file size, which is far cheaper than measuring it.
+ */
+class RegConfigPrefetcher
+{
+private:
+    RegConfigPrefetcher(const RegConfigPrefetcher &) = delete;
+    RegConfigPrefetcher& operator=(const RegConfigPrefetcher &) = delete;
+
+public:
+    static const size_t COST_PER_FILE_BYTE = 8;
+
+    explicit RegConfigPrefetcher(size_t memory_cap);
+
+    ~RegConfigPrefetcher();
+
+public:
+    // Prefetching is disabled if it's 0.
+    void set_memory_cap(size_t memory_cap);
+
+    inline size_t memory_cap(void) const
+    {
+        return m_memory_cap;
+    }
+
+    // Replaces files queued but not fetched yet, and the earlier ones are fetched first.
+    void prefetch(const std::vector<QString> &paths);
+
+    // Keeps a file loaded elsewhere, which is never evicted by itself even if beyond the memory cap.
+    void put(const QString &path, const QJsonDocument &json, RegConfig &&config, const RegConfigStamps &stamps);
+
+    // Moves a fetched file out if neither it nor any file it inherits is modified since being fetched.
+    bool take(const QString &path, QJsonDocument &json, RegConfig &config);
+
+    void stop(void);
+
+    size_t memory_usage(void) const;
+
+private:
+    struct Entry
+    {
+        QJsonDocument json;
+        RegConfig config;
+        RegConfigStamps stamps;
+        size_t cost;
+        uint64_t seq; // in the order of fetching
+    };
+
+    void run(void);
+
+    void insert(const QString &path, Entry &&entry); // with the lock held
+
+private:
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::thread m_worker; // started on the first prefetch()
+    std::deque<QString> m_queue;
+    std::map<QString, Entry> m_entries; // path => entry
+    size_t m_memory_cap;
+    size_t m_memory_usage;
+    uint64_t m_seq;
+    bool m_stopping;
+};
+
+#endif /* #ifndef __REG_PREFETCH_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Check freshness of entries along the inheritance chain via RegConfigStamps.
+ */
+
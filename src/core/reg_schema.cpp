@@ -0,0 +1,1013 @@
+/*
+ * Compiled register schema of configuration files, free of any widgets.
+ *
+ * Copyright (c) 2024-2025 Man Hung-Coeng <udc577@126.com>
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_schema.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <strings.h>
+
+#include <QDir>
+#include <QJsonDocument>
+
+#include "qt_print.hpp"
+#include "reg_archive.hpp"
+
+std::pair<int8_t, int8_t> check_bits_range(const char *range)
+{
+    std::pair<int8_t, int8_t> result = { -1, -1 };
+    char *end_ptr;
+
+    result.first = strtoul(range, &end_ptr, 10);
+
+    if ((0 == result.first && range == end_ptr) // No digits at all.
+        || result.first > 63)
+    {
+        result.first = -1;
+
+        return result;
+    }
+
+    if ('\0' != *range && '\0' == *end_ptr) // Entire string has been parsed.
+    {
+        result.second = result.first;
+
+        return result;
+    }
+
+    char *colon_ptr = (':' == *end_ptr) ? end_ptr : strchr(end_ptr, ':');
+
+    if (nullptr == colon_ptr || '\0' == colon_ptr[1]) // Only a single bit.
+    {
+        result.second = result.first;
+
+        return result;
+    }
+
+    result.second = atoi(colon_ptr + 1);
+
+    if (result.second < 0)
+    {
+        result.first = -1;
+
+        return result;
+    }
+
+    if (result.second > result.first)
+        result.first = result.second = -1;
+
+    return result;
+}
+
+BitsItemDesc check_bits_item_desc_type(const char *desc)
+{
+    if (0 == strcasecmp(desc, "missing"))
+        return BITS_ITEM_DESC_MISSING;
+
+    if (0 == strcasecmp(desc, "TODO"))
+        return BITS_ITEM_DESC_TODO;
+
+    if (0 == strcasecmp(desc, "reserved"))
+        return BITS_ITEM_DESC_RESERVED;
+
+    if (0 == strcasecmp(desc, "enum"))
+        return BITS_ITEM_DESC_ENUM;
+
+    if (0 == strcasecmp(desc, "bool"))
+        return BITS_ITEM_DESC_BOOL;
+
+    if (0 == strcasecmp(desc, "invbool"))
+        return BITS_ITEM_DESC_INVBOOL;
+
+    if (0 == strcasecmp(desc, "decimal"))
+        return BITS_ITEM_DESC_DECIMAL;
+
+    if (0 == strcasecmp(desc, "udecimal"))
+        return BITS_ITEM_DESC_UDECIMAL;
+
+    if (0 == strcasecmp(desc, "hex"))
+        return BITS_ITEM_DESC_HEX;
+
+    return BITS_ITEM_DESC_UNKNOWN;
+}
+
+int RegEnum::find_label(const QString &label) const
+{
+    for (int i = 0; i < labels.size(); ++i)
+    {
+        if (0 == labels[i].compare(label, Qt::CaseInsensitive))
+            return i;
+    }
+
+    return -1;
+}
+
+static void build_enum(RegEnum &result, const std::vector<std::pair<QString, QString>> &pairs)
+{
+    result.labels.clear();
+    result.values.clear();
+    result.others_index = -1;
+    result.others_value = 0;
+    result.value_index.clear();
+    for (const auto &pair : pairs)
+    {
+        const std::string &key_str = pair.first.toStdString();
+        char *end_ptr;
+        uint64_t key_digit = strtoull(key_str.c_str(), &end_ptr, 16);
+        int index = result.labels.size();
+
+        if (key_str.c_str() == end_ptr) // e.g.: "Others"
+            result.others_index = index;
+        else
+            result.value_index.insert({ key_digit, index }); // The first one wins, e.g.: "1" against "0x01".
+
+        result.labels.append(pair.second);
+        result.values.push_back(key_digit);
+    }
+
+    if (result.others_index < 0)
+        return;
+
+    // At most as many steps as defined values.
+    while (result.value_index.count(result.others_value))
+    {
+        ++result.others_value;
+    }
+    result.values[result.others_index] = result.others_value;
+}
+
+RegSchemaPool::RegSchemaPool()
+{
+    build_enum(m_bool_enum, { { "0", "false" }, { "1", "true" } });
+    build_enum(m_invbool_enum, { { "0", "true" }, { "1", "false" } });
+}
+
+RegSchemaPool& RegSchemaPool::instance(void)
+{
+    static RegSchemaPool s_pool;
+
+    return s_pool;
+}
+
+QString RegSchemaPool::intern(const QString &str)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto iter = m_strings.constFind(str);
+
+    if (m_strings.constEnd() != iter)
+        return *iter;
+
+    m_strings.insert(str);
+
+    return str;
+}
+
+const RegEnum* RegSchemaPool::intern_enum(const QJsonObject &enum_dict)
+{
+    std::vector<std::pair<QString, QString>> pairs;
+    QString canonical_text;
+
+    pairs.reserve(enum_dict.size());
+    for (QJsonObject::const_iterator iter = enum_dict.begin(); enum_dict.end() != iter; ++iter)
+    {
+        pairs.push_back({ iter.key(), iter.value().toString("Invalid") });
+        canonical_text += pairs.back().first + '\x1f' + pairs.back().second + '\x1e';
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto iter = m_enum_index.constFind(canonical_text);
+
+    if (m_enum_index.constEnd() != iter)
+        return iter.value();
+
+    m_enums.emplace_back();
+
+    RegEnum &result = m_enums.back();
+
+    build_enum(result, pairs);
+    for (auto &label : result.labels)
+    {
+        auto str_iter = m_strings.constFind(label);
+
+        if (m_strings.constEnd() != str_iter)
+            label = *str_iter;
+        else
+            m_strings.insert(label);
+    }
+    m_enum_index.insert(canonical_text, &result);
+
+    return &result;
+}
+
+QString RegField::name(void) const
+{
+    QString result = this->title.trimmed();
+
+    if (result.endsWith(':'))
+        result.chop(1);
+
+    return result.trimmed();
+}
+
+const RegField* RegInfo::find_field(const QString &name_or_range) const
+{
+    for (const auto &field : this->fields)
+    {
+        if (field.desc_type <= BITS_ITEM_DESC_RESERVED)
+            continue;
+
+        if (0 == field.name().compare(name_or_range, Qt::CaseInsensitive))
+            return &field;
+    }
+
+    for (const auto &field : this->fields)
+    {
+        if (field.range == name_or_range)
+            return &field;
+    }
+
+    return nullptr;
+}
+
+const RegInfo* RegModule::find_register(uint64_t offset) const
+{
+    auto iter = this->offset_index.find(offset);
+
+    return (this->offset_index.end() == iter) ? nullptr : &this->registers[iter->second];
+}
+
+const RegInfo* RegModule::find_register(const QString &name_or_key) const
+{
+    auto iter = this->name_index.find(name_or_key);
+
+    if (this->name_index.end() != iter)
+        return &this->registers[iter->second];
+
+    const std::string &str = name_or_key.toStdString();
+    char *end_ptr;
+    uint64_t offset = strtoull(str.c_str(), &end_ptr, 16);
+
+    return (str.c_str() != end_ptr && '\0' == *end_ptr) ? this->find_register(offset) : nullptr;
+}
+
+const RegModule* RegConfig::find_module(const QString &name) const
+{
+    for (const auto &module : this->modules)
+    {
+        if (module->name == name)
+            return module.get();
+    }
+
+    return nullptr;
+}
+
+int RegConfig::index_of(const RegModule *module) const
+{
+    for (size_t i = 0; i < this->modules.size(); ++i)
+    {
+        if (this->modules[i].get() == module)
+            return static_cast<int>(i);
+    }
+
+    return -1;
+}
+
+int get_bitwidth(const QJsonObject &doc_dict, const QString &key)
+{
+    if (!doc_dict.contains(key))
+        return DEFAULT_BITWIDTH;
+
+    const QJsonValue &width_val = doc_dict.value(key);
+    int result = width_val.isDouble() ? width_val.toDouble()
+        : (width_val.isString() ? atoi(width_val.toString().toStdString().c_str()) : DEFAULT_BITWIDTH);
+
+    return (8 == result || 16 == result || 32 == result || 64 == result) ? result : DEFAULT_BITWIDTH;
+}
+
+uint64_t get_default_value(const QJsonObject &modules_dict, const QString &key)
+{
+    if (!modules_dict.contains("__defaults__"))
+        return 0;
+
+    const QJsonValue &def = modules_dict.value("__defaults__");
+
+    if (!def.isObject())
+        return 0;
+
+    const QJsonObject &def_dict = def.toObject();
+
+    if (!def_dict.contains(key))
+        return 0;
+
+    const QJsonValue &def_val = def_dict.value(key);
+
+    return def_val.isString() ? strtoull(def_val.toString().toStdString().c_str(), nullptr, 16) : 0;
+}
+
+QString find_referenced_register_if_any(const QJsonObject &modules_dict,
+    const QString &orig_key, const QJsonArray &orig_value)
+{
+    for (const QJsonValue &item : orig_value)
+    {
+        if (!item.isObject())
+            continue;
+
+        const QJsonObject &dict = item.toObject();
+
+        if (!dict.contains("ref"))
+            continue;
+
+        const QJsonValue &ref_val = dict.value("ref");
+
+        if (!ref_val.isString())
+            continue;
+
+        QString ref_key(ref_val.toString());
+
+        return modules_dict.contains(ref_key) ? ref_key : QString("");
+    }
+
+    return QString("");
+}
+
+static bool get_hex_property(const QJsonObject &dict, const QString &key, uint64_t &result)
+{
+    const QJsonValue &val = dict.value(key);
+
+    if (!val.isString())
+        return false;
+
+    const std::string &str = val.toString().toStdString();
+    char *end_ptr;
+
+    result = strtoull(str.c_str(), &end_ptr, 16);
+
+    return (end_ptr != str.c_str());
+}
+
+bool get_module_base(const QJsonObject &modules_dict, uint64_t &base)
+{
+    return get_hex_property(modules_dict, "__base__", base);
+}
+
+uint64_t get_module_size(const QJsonObject &modules_dict, int data_bits)
+{
+    uint64_t size = 0;
+
+    if (get_hex_property(modules_dict, "__size__", size) && size > 0)
+        return size;
+
+    uint64_t max_offset = 0;
+    bool has_register = false;
+
+    for (QJsonObject::const_iterator iter = modules_dict.begin(); modules_dict.end() != iter; ++iter)
+    {
+        if (iter.key().startsWith("__"))
+            continue;
+
+        uint64_t offset = strtoull(iter.key().toStdString().c_str(), nullptr, 16);
+
+        if (!has_register || offset > max_offset)
+            max_offset = offset;
+        has_register = true;
+    }
+
+    return has_register ? (max_offset + data_bits / 8) : 0;
+}
+
+// Collected into errors if it's not nullptr, or logged otherwise.
+#define SCHEMA_ERR(errors, fmt, ...)    do { \
+    if (errors) \
+        (errors)->append(QString::asprintf(fmt, ##__VA_ARGS__)); \
+    else \
+        qtCErrV(::, fmt, ##__VA_ARGS__); \
+} while (0)
+
+int compile_reg_fields(const char *reg_key, const QJsonArray &items, std::vector<RegField> &fields,
+    QStringList *errors/* = nullptr */)
+{
+    const char *dict_key = reg_key;
+    int count = items.count();
+    RegSchemaPool &pool = RegSchemaPool::instance();
+
+    fields.clear();
+    fields.reserve(count);
+    for (int i = 0; i < count; ++i)
+    {
+        const QJsonValue &item = items[i];
+
+        if (!item.isObject())
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d] is not a dictionary/map!", dict_key, i);
+            continue;
+        }
+
+        const QJsonObject &dict = item.toObject();
+
+        if (!dict.contains("attr"))
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d] does not contain an \"attr\" property!", dict_key, i);
+            continue;
+        }
+
+        const QJsonValue &attr_val = dict.value("attr");
+
+        if (!attr_val.isArray())
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d]: Value of \"attr\" property is not an array!", dict_key, i);
+            continue;
+        }
+
+        const QJsonArray &attr_arr = attr_val.toArray();
+        int attr_size = attr_arr.count();
+
+        if (attr_size < 3)
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d].attr: Too few elements, just %d!", dict_key, i, attr_size);
+            continue;
+        }
+
+        const std::string &bits_range = attr_arr[0].toString().toStdString();
+        auto range_pair = check_bits_range(bits_range.c_str());
+
+        if (range_pair.first < 0 || range_pair.second < 0)
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d].attr: Invalid bits range: %s", dict_key, i, bits_range.c_str());
+            continue;
+        }
+
+        const std::string &desc_type_str = attr_arr[2].toString().toStdString();
+        auto desc_type = check_bits_item_desc_type(desc_type_str.c_str());
+
+        if (BITS_ITEM_DESC_UNKNOWN == desc_type)
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d].attr[%s]: Invalid description type: %s",
+                dict_key, i, bits_range.c_str(), desc_type_str.c_str());
+            continue;
+        }
+        else if (BITS_ITEM_DESC_ENUM == desc_type)
+        {
+            if (!dict.contains("desc"))
+            {
+                SCHEMA_ERR(errors, "reg[%s]: item[%d] does not contain an \"desc\" property!", dict_key, i);
+                continue;
+            }
+
+            const QJsonValue &desc_val = dict.value("desc");
+
+            if (!desc_val.isObject())
+            {
+                SCHEMA_ERR(errors, "reg[%s]: item[%d]: Value of \"desc\" property is not a dictionary/map!",
+                    dict_key, i);
+                continue;
+            }
+
+            if (desc_val.toObject().count() <= 0)
+            {
+                SCHEMA_ERR(errors, "reg[%s]: item[%d]: \"desc\" dictionary/map is empty!", dict_key, i);
+                continue;
+            }
+        }
+        else if (desc_type > BITS_ITEM_DESC_RESERVED && attr_size < 4)
+        {
+            SCHEMA_ERR(errors, "reg[%s]: item[%d].attr[%s]: Missing title for description type[%s]",
+                dict_key, i, bits_range.c_str(), desc_type_str.c_str());
+            continue;
+        }
+        else
+        {
+            ; // nothing but for the sake of Code of Conduct
+        }
+
+        const RegEnum *enum_def = (BITS_ITEM_DESC_ENUM == desc_type) ? pool.intern_enum(dict.value("desc").toObject())
+            : ((BITS_ITEM_DESC_BOOL == desc_type || BITS_ITEM_DESC_INVBOOL == desc_type)
+                ? pool.bool_enum(BITS_ITEM_DESC_INVBOOL == desc_type) : nullptr);
+
+        fields.push_back({
+            pool.intern(attr_arr[0].toString()),
+            range_pair.first,
+            range_pair.second,
+            (0 == attr_arr[1].toString().compare("RO", Qt::CaseInsensitive)),
+            desc_type,
+            pool.intern((desc_type > BITS_ITEM_DESC_RESERVED) ? attr_arr[3].toString() : attr_arr[2].toString()),
+            (desc_type > BITS_ITEM_DESC_RESERVED && attr_size > 4) ? pool.intern(attr_arr[4].toString()) : QString(),
+            enum_def,
+            false
+        });
+        // No restriction in fact if there's a fallback like "Others", or all values are covered.
+        fields.back().enum_restricted = (enum_def && enum_def->others_index < 0
+            && enum_def->value_index.size() - 1 < fields.back().max_value());
+    } // for (int i : items.count())
+
+    return fields.size();
+}
+
+static void compute_reg_masks(RegInfo &reg, int data_bits)
+{
+    uint64_t covered_mask = 0;
+
+    reg.rw_mask = 0;
+    reg.ro_mask = 0;
+    reg.reserved_mask = 0;
+    reg.enum_fields.clear();
+    for (size_t i = 0; i < reg.fields.size(); ++i)
+    {
+        const RegField &field = reg.fields[i];
+
+        covered_mask |= field.mask();
+
+        if (BITS_ITEM_DESC_RESERVED == field.desc_type)
+            reg.reserved_mask |= field.mask();
+        else if (field.readonly)
+            reg.ro_mask |= field.mask();
+        else
+            reg.rw_mask |= field.mask();
+
+        if (field.enum_restricted)
+            reg.enum_fields.push_back(i);
+    }
+
+    reg.reserved_mask |= ~covered_mask & gen_bits_mask(data_bits - 1, 0);
+}
+
+int compile_reg_module(const QJsonObject &modules_dict, const QString &module_name, RegModule &module,
+    int data_bits, QStringList *errors/* = nullptr */)
+{
+    module.name = module_name;
+    module.prefix = modules_dict.value("__prefix__").toString();
+    module.base = 0;
+    module.has_base = get_module_base(modules_dict, module.base);
+    module.size = get_module_size(modules_dict, data_bits);
+    module.registers.clear();
+    module.offset_index.clear();
+    module.name_index.clear();
+    module.registers.reserve(modules_dict.count());
+
+    QSet<QString> volatile_keys;
+
+    for (const QJsonValue &key : modules_dict.value("__volatile__").toArray())
+    {
+        volatile_keys.insert(key.toString());
+    }
+
+    for (QJsonObject::const_iterator iter = modules_dict.begin(); modules_dict.end() != iter; ++iter)
+    {
+        const QString &orig_key = iter.key();
+
+        if (orig_key.startsWith("__"))
+            continue;
+
+        const QJsonValue &orig_value = iter.value();
+
+        if (!orig_value.isArray())
+        {
+            SCHEMA_ERR(errors, "%s: Value of register[%s] is not an array!",
+                module_name.toStdString().c_str(), orig_key.toStdString().c_str());
+            continue;
+        }
+
+        const QJsonArray &orig_val_arr = orig_value.toArray();
+        QString dest_key = find_referenced_register_if_any(modules_dict, orig_key, orig_val_arr);
+        const QJsonValue &dest_value = dest_key.isEmpty() ? orig_value : modules_dict.value(dest_key);
+
+        if (!dest_value.isArray())
+        {
+            SCHEMA_ERR(errors, "%s: Value of register[%s] is not an array!",
+                module_name.toStdString().c_str(), dest_key.toStdString().c_str());
+            continue;
+        }
+
+        int bar_pos = orig_key.indexOf('|');
+        RegInfo reg;
+
+        reg.key = orig_key;
+        reg.name = (bar_pos < 0) ? orig_key.trimmed() : orig_key.mid(bar_pos + 1).trimmed();
+        reg.ref_key = dest_key;
+        reg.offset = strtoull(orig_key.toStdString().c_str(), nullptr, 16);
+        reg.default_value = get_default_value(modules_dict, orig_key);
+        reg.is_volatile = volatile_keys.contains(orig_key);
+        compile_reg_fields(orig_key.toStdString().c_str(), dest_value.toArray(), reg.fields, errors);
+        compute_reg_masks(reg, data_bits);
+
+        module.offset_index.insert({ reg.offset, module.registers.size() });
+        module.name_index.insert({ reg.name, module.registers.size() });
+        module.name_index.insert({ reg.key, module.registers.size() });
+        module.registers.push_back(std::move(reg));
+    }
+
+    return module.registers.size();
+}
+
+int check_reg_config(const QJsonObject &obj, QString *err_msg)
+{
+    const QJsonValue &val = obj.value("__modules__");
+    QString err;
+
+    if (val.isNull() || val.isUndefined())
+        err = QString::asprintf("There's no __modules__ array, err: %d", val.type());
+    else if (!val.isArray())
+        err = "__modules__ is NOT an array!";
+    else if (val.toArray().empty())
+        err = "Empty __modules__ array!";
+    else
+    {
+        for (const auto &m : val.toArray())
+        {
+            if (!m.isString())
+            {
+                err = "__modules__ is NOT a pure string-array!";
+                break;
+            }
+
+            const QString &module_name = m.toString();
+
+            if (!obj.contains(module_name))
+            {
+                err = QString("Cannot find module: ") + module_name;
+                break;
+            }
+
+            if (!obj.value(module_name).isObject())
+            {
+                err = QString("Module[") + module_name + "] is NOT a dictionary!";
+                break;
+            }
+        }
+    }
+
+    if (err.isEmpty())
+        return 0;
+
+    if (err_msg)
+        *err_msg = err;
+
+    return -EINVAL;
+}
+
+// Compiled modules not overridden are taken from base, if any.
+static int compile_reg_config(const QJsonObject &doc_dict, const QJsonObject &own_dict, const RegConfig *base,
+    const QString &path, RegConfig &config, QString *err_msg)
+{
+    int ret = check_reg_config(doc_dict, err_msg);
+
+    if (ret < 0)
+    {
+        if (err_msg)
+            err_msg->prepend(path + ": ");
+
+        return ret;
+    }
+
+    const QJsonArray &module_names = doc_dict.value("__modules__").toArray();
+    int shared_count = 0;
+
+    config.path = path;
+    config.addr_bits = get_bitwidth(doc_dict, "__addr_bits__");
+    config.data_bits = get_bitwidth(doc_dict, "__data_bits__");
+    config.modules.clear();
+    config.modules.reserve(module_names.count());
+    for (int i = 0; i < module_names.count(); ++i)
+    {
+        const QString &module_name = module_names[i].toString();
+        // Masks of registers depend on data bits, so nothing is shared if they differ.
+        bool inheritable = base && base->data_bits == config.data_bits && !own_dict.contains(module_name);
+        int base_index = inheritable ? base->index_of(base->find_module(module_name)) : -1;
+
+        if (base_index >= 0)
+        {
+            config.modules.push_back(base->modules[base_index]);
+            ++shared_count;
+            continue;
+        }
+
+        std::shared_ptr<RegModule> module = std::make_shared<RegModule>();
+
+        compile_reg_module(doc_dict.value(module_name).toObject(), module_name, *module, config.data_bits);
+        config.modules.push_back(std::move(module));
+    }
+
+    if (base)
+    {
+        qtCDebugV(::, "%s: %d of %d module(s) shared with %s", path.toStdString().c_str(),
+            shared_count, module_names.count(), base->path.toStdString().c_str());
+    }
+
+    return 0;
+}
+
+int compile_reg_config(const QJsonObject &doc_dict, const QString &path, RegConfig &config, QString *err_msg)
+{
+    return compile_reg_config(doc_dict, doc_dict, nullptr, path, config, err_msg);
+}
+
+// Chains longer than this are taken as circular ones.
+#define MAX_INHERIT_DEPTH       8
+
+static int parse_reg_config_file(const QString &path, QJsonObject &doc_dict, QString *err_msg)
+{
+    QByteArray bytes;
+    int ret = read_reg_config_file(path, bytes, err_msg);
+
+    if (ret < 0)
+        return ret;
+
+    QJsonParseError err;
+    const QJsonDocument &doc = QJsonDocument::fromJson(bytes, &err);
+
+    if (QJsonParseError::NoError != err.error)
+    {
+        if (err_msg)
+            *err_msg = path + ": " + err.errorString();
+
+        return -EINVAL;
+    }
+
+    doc_dict = doc.object();
+
+    return 0;
+}
+
+namespace
+{
+
+// A base file with inheritance resolved, and compiled.
+struct RegBaseConfig
+{
+    QJsonObject doc_dict;
+    RegConfig config;
+    int64_t mtime;
+    std::shared_ptr<const RegBaseConfig> base; // the one it inherits in turn, if any
+
+    // Neither this file nor any of its base files is modified since being cached.
+    bool fresh(void) const
+    {
+        int64_t size = 0;
+        int64_t curr_mtime = 0;
+
+        stat_reg_config_file(config.path, size, curr_mtime);
+
+        return curr_mtime == mtime && (!base || base->fresh());
+    }
+};
+
+class RegBaseCache
+{
+public:
+    static RegBaseCache& instance(void)
+    {
+        static RegBaseCache s_cache;
+
+        return s_cache;
+    }
+
+    std::shared_ptr<const RegBaseConfig> get(const QString &path, int depth, QString *err_msg);
+
+private:
+    std::mutex m_mutex;
+    std::map<QString, std::shared_ptr<const RegBaseConfig>> m_entries; // path => entry
+};
+
+} // namespace
+
+static int resolve_reg_config(const QString &path, int depth, QJsonObject &doc_dict,
+    QJsonObject &own_dict, std::shared_ptr<const RegBaseConfig> &base, QString *err_msg)
+{
+    int ret = parse_reg_config_file(path, own_dict, err_msg);
+
+    base.reset();
+    if (ret < 0)
+        return ret;
+
+    const QJsonValue &inherit_val = own_dict.value("__inherit__");
+
+    if (inherit_val.isUndefined())
+    {
+        doc_dict = own_dict;
+
+        return 0;
+    }
+
+    if (!inherit_val.isString() || depth >= MAX_INHERIT_DEPTH)
+    {
+        if (err_msg)
+            *err_msg = path + ": __inherit__ is NOT a string, or the chain is too long or circular!";
+
+        return -EINVAL;
+    }
+
+    // Not via QFileInfo, since the file may be inside the mounted archive.
+    const QString &base_path = QDir::cleanPath(path.left(path.lastIndexOf('/') + 1) + inherit_val.toString());
+
+    if (!(base = RegBaseCache::instance().get(base_path, depth + 1, err_msg)))
+    {
+        if (err_msg)
+            err_msg->prepend(path + ": Failed to inherit: ");
+
+        return -EINVAL;
+    }
+
+    doc_dict = base->doc_dict;
+    doc_dict.remove("__inherit__");
+    for (auto iter = own_dict.begin(); own_dict.end() != iter; ++iter)
+    {
+        const QString &key = iter.key();
+        const QJsonValue &val = iter.value();
+
+        if ("__inherit__" == key)
+            continue;
+
+        if (!val.isObject() || !doc_dict.value(key).isObject())
+        {
+            if (val.isNull())
+                doc_dict.remove(key);
+            else
+                doc_dict.insert(key, val);
+
+            continue;
+        }
+
+        // A module overridden partially.
+        QJsonObject module_dict = doc_dict.value(key).toObject();
+        const QJsonObject &own_module_dict = val.toObject();
+
+        for (auto i = own_module_dict.begin(); own_module_dict.end() != i; ++i)
+        {
+            if (i.value().isNull())
+                module_dict.remove(i.key());
+            else
+                module_dict.insert(i.key(), i.value());
+        }
+        doc_dict.insert(key, module_dict);
+    }
+
+    return 0;
+}
+
+std::shared_ptr<const RegBaseConfig> RegBaseCache::get(const QString &path, int depth, QString *err_msg)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_entries.find(path);
+
+        if (m_entries.end() != iter && iter->second->fresh())
+            return iter->second;
+    }
+
+    // Resolved and compiled without holding the lock, since it may recurse into base files.
+    std::shared_ptr<RegBaseConfig> entry = std::make_shared<RegBaseConfig>();
+    QJsonObject own_dict;
+    int64_t size = 0;
+
+    stat_reg_config_file(path, size, entry->mtime);
+    if (resolve_reg_config(path, depth, entry->doc_dict, own_dict, entry->base, err_msg) < 0
+        || compile_reg_config(entry->doc_dict, own_dict, entry->base ? &entry->base->config : nullptr,
+            path, entry->config, err_msg) < 0)
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries[path] = entry;
+    qtCDebugV(::, "%s: (Re)loaded as a base file with mtime = %ld", path.toStdString().c_str(), entry->mtime);
+
+    return entry;
+}
+
+int read_reg_config_doc(const QString &path, QJsonDocument &doc, QString *err_msg)
+{
+    QJsonObject doc_dict;
+    QJsonObject own_dict;
+    std::shared_ptr<const RegBaseConfig> base;
+    int ret = resolve_reg_config(path, 0, doc_dict, own_dict, base, err_msg);
+
+    if (ret < 0)
+        return ret;
+
+    doc.setObject(doc_dict);
+
+    return 0;
+}
+
+bool reg_config_stamps_fresh(const RegConfigStamps &stamps)
+{
+    for (const auto &stamp : stamps)
+    {
+        int64_t size = 0;
+        int64_t mtime = 0;
+
+        stat_reg_config_file(stamp.first, size, mtime);
+        if (mtime != stamp.second)
+            return false;
+    }
+
+    return true;
+}
+
+int load_reg_config(const QString &path, RegConfig &config, QString *err_msg, QJsonDocument *doc/* = nullptr */,
+    RegConfigStamps *stamps/* = nullptr */)
+{
+    QJsonObject doc_dict;
+    QJsonObject own_dict;
+    std::shared_ptr<const RegBaseConfig> base;
+    int64_t size = 0;
+    int64_t mtime = 0;
+    int ret;
+
+    stat_reg_config_file(path, size, mtime); // before reading, so that changes during loading are not missed
+    if ((ret = resolve_reg_config(path, 0, doc_dict, own_dict, base, err_msg)) < 0)
+        return ret;
+
+    if (doc)
+        doc->setObject(doc_dict);
+
+    if (stamps)
+    {
+        stamps->assign(1, { path, mtime });
+        for (const RegBaseConfig *b = base.get(); b; b = b->base.get())
+        {
+            stamps->push_back({ b->config.path, b->mtime });
+        }
+    }
+
+    return compile_reg_config(doc_dict, own_dict, base ? &base->config : nullptr, path, config, err_msg);
+}
+
+std::shared_ptr<const RegConfig> RegConfigCache::get(const QString &path, QString *err_msg)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto iter = m_entries.find(path);
+
+        // Any change along the inheritance chain makes it stale as well.
+        if (m_entries.end() != iter && reg_config_stamps_fresh(iter->second.stamps))
+            return iter->second.config;
+    }
+
+    // Loaded without holding the lock, so that requests of other files are not blocked.
+    std::shared_ptr<RegConfig> config = std::make_shared<RegConfig>();
+    RegConfigStamps stamps;
+    int ret = load_reg_config(path, *config, err_msg, nullptr, &stamps);
+
+    if (ret < 0)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    qtCDebugV(::, "%s: (Re)loaded with mtime = %ld", path.toStdString().c_str(), stamps.front().second);
+    m_entries[path] = { config, std::move(stamps) };
+
+    return config;
+}
+
+void RegConfigCache::clear(void)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_entries.clear();
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit, with some functions moved from
+ *      regpanel.cpp, private_widgets.cpp and soc_map.cpp.
+ *  02. Add RegConfigCache for long-running headless modes.
+ *  03. Precompute access masks and legal enum values at load time for validation.
+ *  04. Split compile_reg_config() out of load_reg_config().
+ *  05. Intern field strings and enum definitions via RegSchemaPool.
+ *  06. Replace the sorted index of enum values with a hash one, and
+ *      precompute the value taken by the "Others" option.
+ *  07. Keep the parsed document of load_reg_config() on demand.
+ *  08. Read configuration files via read_reg_config_file(), which looks up
+ *      the mounted archive first.
+ *  09. Support inheriting another configuration file via "__inherit__", with base files
+ *      cached process-wide and their compiled modules shared by files inheriting them.
+ *  10. Collect errors of compile_reg_fields() and compile_reg_module() on demand instead of logging them.
+ *  11. Compute the size of address space of each module at compile time.
+ *  12. Invalidate entries of RegConfigCache on changes of files they inherit as well,
+ *      by recording the path and mtime of each base file along the chain.
+ *  13. Record the stamps of the inheritance chain in load_reg_config() via RegConfigStamps,
+ *      so that RegConfigPrefetcher checks freshness the same way as RegConfigCache.
+ *  14. Compile the "__volatile__" property of modules into RegInfo::is_volatile.
+ */
+
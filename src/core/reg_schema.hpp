@@ -0,0 +1,340 @@
+/*
+ * Compiled register schema of configuration files, free of any widgets.
+ *
+ * Copyright (c) 2024-2025 Man Hung-Coeng <udc577@126.com>
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_SCHEMA_HPP__
+#define __REG_SCHEMA_HPP__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+#include <QString>
+#include <QStringList>
+#include <QHash>
+#include <QSet>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QJsonDocument>
+
+enum BitsItemDesc
+{
+    BITS_ITEM_DESC_UNKNOWN,
+    BITS_ITEM_DESC_MISSING,
+    BITS_ITEM_DESC_TODO,
+    BITS_ITEM_DESC_RESERVED,
+    BITS_ITEM_DESC_ENUM,
+    BITS_ITEM_DESC_BOOL,
+    BITS_ITEM_DESC_INVBOOL, // inverse bool
+    BITS_ITEM_DESC_DECIMAL,
+    BITS_ITEM_DESC_UDECIMAL, // unsigned decimal
+    BITS_ITEM_DESC_HEX
+};
+
+std::pair<int8_t, int8_t> check_bits_range(const char *range);
+
+BitsItemDesc check_bits_item_desc_type(const char *desc);
+
+static inline uint64_t u64_lshift(uint64_t value, uint8_t shift)
+{
+    return (shift >= 64) ? 0 : (value << shift);
+}
+
+static inline uint64_t u64_rshift(uint64_t value, uint8_t shift)
+{
+    return (shift >= 64) ? 0 : (value >> shift);
+}
+
+static inline uint64_t gen_bits_mask(int8_t high, int8_t low)
+{
+    return ~u64_lshift(UINT64_MAX, high - low + 1);
+}
+
+// Immutable once built, and shared by all fields with identical definitions, see RegSchemaPool.
+struct RegEnum
+{
+    QStringList labels;
+    std::vector<uint64_t> values; // values[i] is that of labels[i], or others_value for others_index
+    int others_index; // index of the non-numeric key like "Others", or -1 if absent
+    uint64_t others_value; // the smallest value not defined, taken when "Others" is selected
+    std::unordered_map<uint64_t, int> value_index; // distinct value => index of labels
+
+    // Returns index of labels, or -1 if the value is not defined.
+    inline int find(uint64_t value) const
+    {
+        auto iter = value_index.find(value);
+
+        return (value_index.end() != iter) ? iter->second : -1;
+    }
+
+    // The same as find(), except falling back to others_index.
+    inline int index_of(uint64_t value) const
+    {
+        int index = this->find(value);
+
+        return (index < 0) ? others_index : index;
+    }
+
+    // Case-insensitive. Returns -1 if not found.
+    int find_label(const QString &label) const;
+};
+
+struct RegField
+{
+    QString range; // original text, e.g.: "31:1"
+    int8_t high;
+    int8_t low;
+    bool readonly;
+    BitsItemDesc desc_type;
+    QString title; // e.g.: "n_lanes:", or the description type itself for "missing", "TODO" and "reserved" items
+    QString hint;
+    const RegEnum *enum_def; // for "enum", "bool" and "invbool" items only, owned by RegSchemaPool
+    bool enum_restricted; // true if some values are out of the enum set
+
+    inline uint64_t max_value(void) const
+    {
+        return gen_bits_mask(high, low);
+    }
+
+    inline uint64_t mask(void) const
+    {
+        return u64_lshift(this->max_value(), low);
+    }
+
+    inline uint64_t extract(uint64_t full_value) const
+    {
+        return u64_rshift(full_value, low) & this->max_value();
+    }
+
+    inline uint64_t merge(uint64_t full_value, uint64_t bits_value) const
+    {
+        return (full_value & ~this->mask()) | (u64_lshift(bits_value, low) & this->mask());
+    }
+
+    inline bool is_legal(uint64_t bits_value) const
+    {
+        return !enum_restricted || enum_def->find(bits_value) >= 0;
+    }
+
+    // Title without the trailing colon, e.g.: "n_lanes"
+    QString name(void) const;
+};
+
+struct RegInfo
+{
+    QString key; // e.g.: "0x0040 | CONTROL"
+    QString name; // e.g.: "CONTROL"
+    QString ref_key; // key of the register whose items are referenced, if any
+    uint64_t offset;
+    uint64_t default_value;
+    std::vector<RegField> fields;
+    // Precomputed by compile_reg_module(), all within "__data_bits__".
+    uint64_t rw_mask; // writable bits, aka: the write mask
+    uint64_t ro_mask; // bits of read-only fields
+    uint64_t reserved_mask; // bits of reserved fields, and those not covered by any field
+    bool is_volatile; // listed in "__volatile__" of the module
+    std::vector<size_t> enum_fields; // indexes of fields with restricted enum values
+
+    // Matches the name of a field, or its bits range.
+    const RegField* find_field(const QString &name_or_range) const;
+};
+
+struct RegModule
+{
+    QString name;
+    QString prefix;
+    uint64_t base;
+    bool has_base;
+    uint64_t size; // of the address space, see get_module_size()
+    std::vector<RegInfo> registers; // in the same order as JSON keys
+    std::map<uint64_t, size_t> offset_index; // offset => index of registers
+    std::map<QString, size_t> name_index; // name and key => index of registers
+
+    const RegInfo* find_register(uint64_t offset) const;
+
+    // Matches the name of a register, its key, or its offset in hexadecimal.
+    const RegInfo* find_register(const QString &name_or_key) const;
+};
+
+struct RegConfig
+{
+    QString path;
+    int addr_bits;
+    int data_bits;
+    // In the order of "__modules__". Those inherited as they are share the compiled ones of the base file.
+    std::vector<std::shared_ptr<const RegModule>> modules;
+
+    const RegModule* find_module(const QString &name) const;
+
+    // Returns the index of modules, or -1 if it's not one of them.
+    int index_of(const RegModule *module) const;
+};
+
+/*
+ * Process-wide pool of schema strings and enum definitions, so that identical ones
+ * of all registers, modules and configuration files share the same storage.
+ * Entries live as long as the process, thus pointers to enum definitions never dangle.
+ */
+class RegSchemaPool
+{
+private:
+    RegSchemaPool(const RegSchemaPool &) = delete;
+    RegSchemaPool& operator=(const RegSchemaPool &) = delete;
+
+    RegSchemaPool();
+
+public:
+    static RegSchemaPool& instance(void);
+
+    QString intern(const QString &str);
+
+    const RegEnum* intern_enum(const QJsonObject &enum_dict);
+
+    const RegEnum* bool_enum(bool inverse) const
+    {
+        return inverse ? &m_invbool_enum : &m_bool_enum;
+    }
+
+private:
+    std::mutex m_mutex;
+    QSet<QString> m_strings;
+    QHash<QString, const RegEnum *> m_enum_index; // canonical text of definition => enum
+    std::deque<RegEnum> m_enums;
+    RegEnum m_bool_enum;
+    RegEnum m_invbool_enum;
+};
+
+#define DEFAULT_BITWIDTH        32
+
+// For "__addr_bits__" and "__data_bits__" properties of a configuration file.
+int get_bitwidth(const QJsonObject &doc_dict, const QString &key);
+
+uint64_t get_default_value(const QJsonObject &modules_dict, const QString &key);
+
+QString find_referenced_register_if_any(const QJsonObject &modules_dict,
+    const QString &orig_key, const QJsonArray &orig_value);
+
+/*
+ * Optional properties of a module dictionary in configuration files:
+ *
+ *   "__base__": "0xFDD10000",  // physical base address of the module
+ *   "__size__": "0x10000",     // size of the address space, derived from registers if absent
+ *   "__volatile__": [ "0x0008 | STATUS" ], // keys of registers updated by hardware, not to be cached
+ */
+bool get_module_base(const QJsonObject &modules_dict, uint64_t &base);
+
+uint64_t get_module_size(const QJsonObject &modules_dict, int data_bits);
+
+// Invalid items are skipped, and logged or collected into errors if it's not nullptr. Returns the number of valid ones.
+int compile_reg_fields(const char *reg_key, const QJsonArray &items, std::vector<RegField> &fields,
+    QStringList *errors = nullptr);
+
+// Returns the number of compiled registers. Errors are handled the same as compile_reg_fields().
+int compile_reg_module(const QJsonObject &modules_dict, const QString &module_name, RegModule &module,
+    int data_bits = DEFAULT_BITWIDTH, QStringList *errors = nullptr);
+
+// Returns 0 on success, or a negative errno with err_msg filled.
+int check_reg_config(const QJsonObject &doc_dict, QString *err_msg);
+
+// Compiles an already parsed document. Returns 0 on success, or a negative errno with err_msg filled.
+int compile_reg_config(const QJsonObject &doc_dict, const QString &path, RegConfig &config, QString *err_msg);
+
+/*
+ * A configuration file may inherit all of another one, and override part of it:
+ *
+ *   "__inherit__": "../rk3588/mipi.json", // relative to the directory of this file
+ *
+ * Top-level properties of this file replace those of the base file, except that a module dictionary
+ * is merged with the one of the same name in the base file: its registers and properties replace or add to
+ * those of the base module, and a null value removes one. The base file may inherit another one in turn.
+ *
+ * Base files are parsed and compiled once and cached process-wide, and compiled modules not overridden
+ * are shared by all files inheriting them, so that loading a variant only parses and compiles its own part.
+ *
+ * Reads, parses and resolves inheritance. Returns 0 on success, or a negative errno with err_msg filled.
+ */
+int read_reg_config_doc(const QString &path, QJsonDocument &doc, QString *err_msg);
+
+// Path and mtime of a configuration file and of each base file along its inheritance chain, itself first.
+typedef std::vector<std::pair<QString, int64_t>> RegConfigStamps;
+
+// Whether none of the stamped files is modified since then.
+bool reg_config_stamps_fresh(const RegConfigStamps &stamps);
+
+/*
+ * Returns 0 on success, or a negative errno with err_msg filled.
+ * The parsed document is kept in doc, and the stamps of files loaded in stamps, if they're not nullptr.
+ */
+int load_reg_config(const QString &path, RegConfig &config, QString *err_msg, QJsonDocument *doc = nullptr,
+    RegConfigStamps *stamps = nullptr);
+
+/*
+ * Thread-safe cache of compiled configurations, shared by concurrent readers.
+ * A cached one is dropped and reloaded once its file or any file it inherits is modified.
+ */
+class RegConfigCache
+{
+public:
+    // Returns nullptr with err_msg filled on failure.
+    std::shared_ptr<const RegConfig> get(const QString &path, QString *err_msg);
+
+    void clear(void);
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<const RegConfig> config;
+        RegConfigStamps stamps;
+    };
+
+    std::mutex m_mutex;
+    std::map<QString, Entry> m_entries; // path => entry
+};
+
+#endif /* #ifndef __REG_SCHEMA_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit, with some functions moved from
+ *      regpanel.cpp, private_widgets.cpp and soc_map.cpp.
+ *  02. Add RegConfigCache for long-running headless modes.
+ *  03. Precompute access masks and legal enum values at load time for validation,
+ *      and add compile_reg_config() for documents already parsed.
+ *  04. Add RegSchemaPool to share schema strings and enum definitions.
+ *  05. Look up enum values via a hash index.
+ *  06. Add a parameter to load_reg_config() for keeping the parsed document.
+ *  07. Support inheriting another configuration file via "__inherit__",
+ *      and share compiled modules of base files via pointers.
+ *  08. Add a parameter to compile_reg_fields() and compile_reg_module() for collecting errors.
+ *  09. Add the size of address space to RegModule.
+ *  10. Invalidate entries of RegConfigCache on changes of files they inherit as well.
+ *  11. Add RegConfigStamps and a parameter to load_reg_config() for checking freshness
+ *      along the inheritance chain outside RegConfigCache as well.
+ *  12. Add RegInfo::is_volatile for the "__volatile__" property of modules.
+ */
+
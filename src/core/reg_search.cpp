@@ -0,0 +1,281 @@
+/*
+ * Search index of registers across all configuration files.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_search.hpp"
+
+#include <algorithm>
+
+#include "qt_print.hpp"
+
+static inline bool is_token_char(char c)
+{
+    return ('a' <= c && c <= 'z') || ('0' <= c && c <= '9') || '_' == c;
+}
+
+static inline uint32_t trigram_of(const char *str)
+{
+    return (static_cast<uint8_t>(str[0]) << 16) | (static_cast<uint8_t>(str[1]) << 8) | static_cast<uint8_t>(str[2]);
+}
+
+static void split_tokens(const QString &text, std::vector<std::string> &tokens)
+{
+    const std::string &lower_text = text.toLower().toStdString();
+    size_t begin = 0;
+
+    tokens.clear();
+    for (size_t i = 0; i <= lower_text.size(); ++i)
+    {
+        if (i < lower_text.size() && is_token_char(lower_text[i]))
+            continue;
+
+        if (i > begin)
+            tokens.push_back(lower_text.substr(begin, i - begin));
+        begin = i + 1;
+    }
+}
+
+static void intersect_sorted(std::vector<uint32_t> &dest, const std::vector<uint32_t> &src)
+{
+    auto end = std::set_intersection(dest.begin(), dest.end(), src.begin(), src.end(), dest.begin());
+
+    dest.erase(end, dest.end());
+}
+
+RegSearchIndex::RegSearchIndex()
+    : m_stopping(false)
+    , m_building(false)
+{
+}
+
+RegSearchIndex::~RegSearchIndex()
+{
+    this->stop();
+}
+
+void RegSearchIndex::build_async(const std::string &config_dir, const std::vector<std::string> &rel_paths)
+{
+    this->stop();
+
+    m_stopping = false;
+    m_building = true;
+    m_builder = std::thread([this, config_dir, rel_paths]() {
+        size_t count = 0;
+
+        for (const auto &rel_path : rel_paths)
+        {
+            if (m_stopping)
+                break;
+
+            RegConfig config;
+            QString err_msg;
+
+            if (load_reg_config(QString::fromStdString(config_dir + "/" + rel_path), config, &err_msg) < 0)
+            {
+                qtCWarnV(::, "Skipped indexing: %s", err_msg.toStdString().c_str());
+                continue;
+            }
+
+            count += this->add_config(QString::fromStdString(rel_path), config);
+        }
+
+        qtCDebugV(::, "Indexed %lu register(s) of %lu file(s).", count, rel_paths.size());
+        m_building = false;
+    });
+}
+
+void RegSearchIndex::stop(void)
+{
+    m_stopping = true;
+    if (m_builder.joinable())
+        m_builder.join();
+    m_building = false;
+}
+
+size_t RegSearchIndex::add_config(const QString &rel_path, const RegConfig &config)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t old_count = m_entries.size();
+
+    for (const auto &module : config.modules)
+    {
+        for (const auto &reg : module->registers)
+        {
+            uint32_t entry_index = static_cast<uint32_t>(m_entries.size());
+            uint64_t addr = module->has_base ? (module->base + reg.offset) : reg.offset;
+
+            m_entries.push_back({ rel_path, module->name, reg.key, addr });
+            this->add_text(entry_index, module->name);
+            this->add_text(entry_index, reg.key);
+            this->add_text(entry_index, QString::asprintf("0x%lx", addr));
+            for (const auto &field : reg.fields)
+            {
+                this->add_text(entry_index, field.name());
+                if (!field.hint.isEmpty())
+                    this->add_text(entry_index, field.hint);
+            }
+        }
+    }
+
+    return m_entries.size() - old_count;
+}
+
+void RegSearchIndex::add_text(uint32_t entry_index, const QString &text)
+{
+    std::vector<std::string> tokens;
+
+    split_tokens(text, tokens);
+    for (const auto &token : tokens)
+    {
+        this->add_token(entry_index, token);
+    }
+}
+
+void RegSearchIndex::add_token(uint32_t entry_index, const std::string &token)
+{
+    auto iter = m_token_ids.find(token);
+    uint32_t token_id;
+
+    if (m_token_ids.end() != iter)
+        token_id = iter->second;
+    else
+    {
+        token_id = static_cast<uint32_t>(m_tokens.size());
+        m_token_ids.insert({ token, token_id });
+        m_tokens.push_back(token);
+        m_postings.push_back(std::vector<uint32_t>());
+
+        for (size_t i = 0; i + 3 <= token.size(); ++i)
+        {
+            std::vector<uint32_t> &token_ids = m_trigrams[trigram_of(token.c_str() + i)];
+
+            if (token_ids.empty() || token_ids.back() != token_id)
+                token_ids.push_back(token_id);
+        }
+    }
+
+    std::vector<uint32_t> &posting = m_postings[token_id];
+
+    // Entries are added in ascending order, so a duplicate can only be the last one.
+    if (posting.empty() || posting.back() != entry_index)
+        posting.push_back(entry_index);
+}
+
+void RegSearchIndex::match_term(const std::string &term, std::vector<uint32_t> &entries) const
+{
+    entries.clear();
+
+    if (term.size() < 3)
+    {
+        for (auto iter = m_token_ids.lower_bound(term);
+            m_token_ids.end() != iter && 0 == iter->first.compare(0, term.size(), term); ++iter)
+        {
+            const std::vector<uint32_t> &posting = m_postings[iter->second];
+
+            entries.insert(entries.end(), posting.begin(), posting.end());
+        }
+    }
+    else
+    {
+        std::vector<const std::vector<uint32_t> *> lists;
+
+        for (size_t i = 0; i + 3 <= term.size(); ++i)
+        {
+            auto iter = m_trigrams.find(trigram_of(term.c_str() + i));
+
+            if (m_trigrams.end() == iter)
+                return;
+
+            lists.push_back(&iter->second);
+        }
+
+        // Starts from the shortest list to keep intersections small.
+        std::sort(lists.begin(), lists.end(), [](const std::vector<uint32_t> *a, const std::vector<uint32_t> *b) {
+            return a->size() < b->size();
+        });
+
+        std::vector<uint32_t> token_ids(*lists.front());
+
+        for (size_t i = 1; i < lists.size() && !token_ids.empty(); ++i)
+        {
+            intersect_sorted(token_ids, *lists[i]);
+        }
+
+        for (uint32_t token_id : token_ids)
+        {
+            // Trigrams may appear in a token without being adjacent as in term.
+            if (std::string::npos == m_tokens[token_id].find(term))
+                continue;
+
+            const std::vector<uint32_t> &posting = m_postings[token_id];
+
+            entries.insert(entries.end(), posting.begin(), posting.end());
+        }
+    }
+
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+}
+
+std::vector<RegSearchIndex::Entry> RegSearchIndex::search(const QString &query, size_t max_count) const
+{
+    std::vector<std::string> terms;
+    std::vector<uint32_t> matched;
+    std::vector<uint32_t> term_matched;
+    std::vector<Entry> result;
+
+    split_tokens(query, terms);
+    if (terms.empty())
+        return result;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (size_t i = 0; i < terms.size(); ++i)
+    {
+        this->match_term(terms[i], (0 == i) ? matched : term_matched);
+        if (i > 0)
+            intersect_sorted(matched, term_matched);
+        if (matched.empty())
+            break;
+    }
+
+    result.reserve(std::min(max_count, matched.size()));
+    for (size_t i = 0; i < matched.size() && i < max_count; ++i)
+    {
+        result.push_back(m_entries[matched[i]]);
+    }
+
+    return result;
+}
+
+size_t RegSearchIndex::entry_count(void) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_entries.size();
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Access compiled modules via shared pointers.
+ */
+
@@ -0,0 +1,116 @@
+/*
+ * Search index of registers across all configuration files.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_SEARCH_HPP__
+#define __REG_SEARCH_HPP__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+#include <QString>
+
+#include "reg_schema.hpp"
+
+/*
+ * Names of modules, registers and fields, hints and addresses are split into lower-case tokens
+ * of [0-9a-z_]. Tokens are kept in a sorted map for prefix matching, and each trigram of them
+ * points to the tokens containing it for substring matching, so that a query costs a few lookups
+ * and set intersections rather than a scan over all registers.
+ *
+ * Files are indexed one after another in a background thread, and searches run at any time
+ * against those indexed so far.
+ */
+class RegSearchIndex
+{
+private:
+    RegSearchIndex(const RegSearchIndex &) = delete;
+    RegSearchIndex& operator=(const RegSearchIndex &) = delete;
+
+public:
+    struct Entry
+    {
+        QString path; // relative path of configuration file, e.g.: "rockchip/rk3588/mipi.json"
+        QString module;
+        QString reg_key;
+        uint64_t addr; // absolute address if the module has a "__base__", or the offset otherwise
+    };
+
+    RegSearchIndex();
+
+    ~RegSearchIndex();
+
+public:
+    // Indexes files in "config_dir/rel_path" in a background thread. Any previous building is stopped at first.
+    void build_async(const std::string &config_dir, const std::vector<std::string> &rel_paths);
+
+    void stop(void);
+
+    inline bool building(void) const
+    {
+        return m_building;
+    }
+
+    // Thread-safe. Returns the number of registers indexed.
+    size_t add_config(const QString &rel_path, const RegConfig &config);
+
+    /*
+     * Each whitespace-separated term of query must match a token of the register,
+     * by prefix if it's shorter than 3 characters, or by substring otherwise.
+     * Results are in the order of indexing, and at most max_count ones are returned.
+     */
+    std::vector<Entry> search(const QString &query, size_t max_count) const;
+
+    size_t entry_count(void) const;
+
+private:
+    void add_text(uint32_t entry_index, const QString &text);
+
+    void add_token(uint32_t entry_index, const std::string &token);
+
+    void match_term(const std::string &term, std::vector<uint32_t> &entries) const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::thread m_builder;
+    std::atomic<bool> m_stopping;
+    std::atomic<bool> m_building;
+    std::vector<Entry> m_entries;
+    std::vector<std::string> m_tokens;
+    std::vector<std::vector<uint32_t>> m_postings; // token id => entry indexes in ascending order
+    std::map<std::string, uint32_t> m_token_ids;
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_trigrams; // 3 bytes => token ids in ascending order
+};
+
+#endif /* #ifndef __REG_SEARCH_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,528 @@
+/*
+ * Long-running headless server of register decoding/encoding over a Unix domain socket.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_server.hpp"
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#include <algorithm>
+#include <chrono>
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QStringList>
+
+#include "qt_print.hpp"
+#include "reg_codec.hpp"
+#include "reg_decoder.hpp"
+#include "reg_encoder.hpp"
+
+#define MAX_FRAME_SIZE                  (16 * 1024 * 1024)
+#define FRAME_TIMEOUT_MS                5000
+#define POLL_TIMEOUT_MS                 500
+
+volatile sig_atomic_t RegServer::s_stop_requested = 0;
+
+RegServer::RegServer(const std::string &config_dir, const std::string &socket_path, int worker_count)
+    : m_config_dir(config_dir)
+    , m_socket_path(socket_path)
+    , m_worker_count((worker_count > 0) ? worker_count : 1)
+    , m_wakeup_pipe{ -1, -1 }
+    , m_stopping(false)
+{
+}
+
+RegServer::~RegServer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stopping = true;
+    }
+    m_cond.notify_all();
+
+    for (auto &t : m_workers)
+    {
+        if (t.joinable())
+            t.join();
+    }
+
+    for (const auto &c : m_conns)
+    {
+        close(c.first);
+    }
+
+    for (int fd : m_wakeup_pipe)
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+}
+
+static inline int64_t now_ms(void)
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Polled in slices so that stop requests are not missed while the peer doesn't receive.
+static bool wait_writable(int fd, int timeout_ms)
+{
+    for (int waited = 0; waited < timeout_ms && !RegServer::stop_requested(); waited += POLL_TIMEOUT_MS)
+    {
+        struct pollfd pfd = { fd, POLLOUT, 0 };
+        int ret = poll(&pfd, 1, std::min(timeout_ms - waited, POLL_TIMEOUT_MS));
+
+        if (ret > 0)
+            return !(pfd.revents & (POLLERR | POLLHUP));
+
+        if (ret < 0 && EINTR != errno)
+            return false;
+    }
+
+    return false;
+}
+
+// Sockets are non-blocking, and each wait for the peer lasts no more than timeout_ms.
+static bool write_fully(int fd, const void *buf, size_t len, int timeout_ms)
+{
+    const char *ptr = static_cast<const char *>(buf);
+
+    while (len > 0)
+    {
+        ssize_t n = send(fd, ptr, len, MSG_NOSIGNAL);
+
+        if (n < 0 && EINTR == errno)
+            continue;
+
+        if (n < 0 && (EAGAIN == errno || EWOULDBLOCK == errno) && wait_writable(fd, timeout_ms))
+            continue;
+
+        if (n <= 0)
+            return false;
+
+        ptr += n;
+        len -= n;
+    }
+
+    return true;
+}
+
+static bool write_frame(int fd, const QJsonObject &obj, int timeout_ms)
+{
+    const QByteArray &payload = QJsonDocument(obj).toJson(QJsonDocument::Compact);
+    uint32_t len = payload.size();
+    unsigned char header[4] = {
+        static_cast<unsigned char>(len >> 24), static_cast<unsigned char>(len >> 16),
+        static_cast<unsigned char>(len >> 8), static_cast<unsigned char>(len)
+    };
+
+    return write_fully(fd, header, sizeof(header), timeout_ms)
+        && write_fully(fd, payload.constData(), len, timeout_ms);
+}
+
+static inline QJsonObject error_response(int err, const QString &msg)
+{
+    return QJsonObject({ { "status", err }, { "error", msg } });
+}
+
+int RegServer::run(void)
+{
+    struct sockaddr_un addr = {};
+    int listen_fd;
+
+    if (m_socket_path.size() >= sizeof(addr.sun_path))
+    {
+        qtCErrV(::, "Socket path is too long: %s", m_socket_path.c_str());
+
+        return -ENAMETOOLONG;
+    }
+
+    if (pipe2(m_wakeup_pipe, O_NONBLOCK | O_CLOEXEC) < 0)
+    {
+        int err = errno;
+
+        qtCErrV(::, "pipe() failed: %s", strerror(err));
+
+        return -err;
+    }
+
+    if ((listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+    {
+        int err = errno;
+
+        qtCErrV(::, "socket() failed: %s", strerror(err));
+
+        return -err;
+    }
+
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, m_socket_path.c_str(), sizeof(addr.sun_path) - 1);
+    unlink(m_socket_path.c_str()); // in case of a stale one left by a crashed server
+
+    if (bind(listen_fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0
+        || chmod(m_socket_path.c_str(), S_IRUSR | S_IWUSR) < 0
+        || listen(listen_fd, SOMAXCONN) < 0)
+    {
+        int err = errno;
+
+        qtCErrV(::, "Failed to listen on %s: %s", m_socket_path.c_str(), strerror(err));
+        close(listen_fd);
+
+        return -err;
+    }
+
+    s_stop_requested = 0;
+    m_stopping = false;
+    m_workers.reserve(m_worker_count);
+    for (int i = 0; i < m_worker_count; ++i)
+    {
+        m_workers.emplace_back(&RegServer::worker_loop, this);
+    }
+    qtCDebugV(::, "Listening on %s with %d worker(s)", m_socket_path.c_str(), m_worker_count);
+
+    std::vector<struct pollfd> pfds;
+
+    while (!s_stop_requested)
+    {
+        pfds.clear();
+        pfds.push_back({ listen_fd, POLLIN, 0 });
+        pfds.push_back({ m_wakeup_pipe[0], POLLIN, 0 });
+        for (const auto &c : m_conns)
+        {
+            if (!c.second.busy)
+                pfds.push_back({ c.first, POLLIN, 0 });
+        }
+
+        if (poll(pfds.data(), pfds.size(), POLL_TIMEOUT_MS) < 0)
+            continue; // EINTR, then check the stop flag again
+
+        if (pfds[1].revents)
+            this->take_served_connections();
+
+        // Only connections polled above are checked, since the ones just taken back have no revents yet.
+        for (size_t i = 2; i < pfds.size(); ++i)
+        {
+            auto iter = m_conns.find(pfds[i].fd);
+
+            if (0 == pfds[i].revents || m_conns.end() == iter)
+                continue;
+
+            if (this->receive(iter->first, iter->second) < 0)
+            {
+                close(iter->first);
+                m_conns.erase(iter);
+            }
+        }
+
+        if (pfds[0].revents)
+        {
+            int conn_fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC | SOCK_NONBLOCK);
+
+            if (conn_fd >= 0)
+                m_conns[conn_fd] = { QByteArray(), 0, false };
+            else if (EINTR != errno && EAGAIN != errno)
+                qtCErrV(::, "accept() failed: %s", strerror(errno));
+            else
+            {
+                ; // nothing but for the sake of Code of Conduct
+            }
+        }
+
+        this->drop_stale_connections();
+    } // while (!s_stop_requested)
+
+    close(listen_fd);
+    unlink(m_socket_path.c_str());
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stopping = true;
+    }
+    m_cond.notify_all();
+    for (auto &t : m_workers)
+    {
+        t.join();
+    }
+    m_workers.clear();
+
+    // Connections with requests never handled are closed along with the idle ones.
+    for (const auto &c : m_conns)
+    {
+        close(c.first);
+    }
+    m_conns.clear();
+    m_requests.clear();
+    m_served.clear();
+    for (int &fd : m_wakeup_pipe)
+    {
+        close(fd);
+        fd = -1;
+    }
+
+    return 0;
+}
+
+int RegServer::receive(int conn_fd, Connection &conn)
+{
+    char buf[4096];
+    ssize_t n = read(conn_fd, buf, sizeof(buf));
+
+    if (n < 0)
+        return (EINTR == errno || EAGAIN == errno || EWOULDBLOCK == errno) ? 0 : -1;
+
+    if (0 == n)
+        return -1; // closed by peer
+
+    if (conn.buffer.isEmpty())
+        conn.deadline_ms = now_ms() + FRAME_TIMEOUT_MS;
+    conn.buffer.append(buf, n);
+
+    return (this->dispatch(conn_fd, conn) < 0) ? -1 : 0;
+}
+
+int RegServer::dispatch(int conn_fd, Connection &conn)
+{
+    if (conn.buffer.size() < 4)
+        return 0;
+
+    const unsigned char *header = reinterpret_cast<const unsigned char *>(conn.buffer.constData());
+    uint32_t len = (header[0] << 24) | (header[1] << 16) | (header[2] << 8) | header[3];
+
+    if (len > MAX_FRAME_SIZE)
+    {
+        // Not waiting for the peer to receive it, since it's written by the polling thread.
+        write_frame(conn_fd, error_response(EMSGSIZE, QString::asprintf("Frame too large: %u bytes", len)), 0);
+
+        return -1;
+    }
+
+    if (static_cast<uint32_t>(conn.buffer.size() - 4) < len)
+        return 0;
+
+    Request request = { conn_fd, conn.buffer.mid(4, len) };
+
+    conn.buffer.remove(0, 4 + len);
+    conn.busy = true;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_requests.push_back(std::move(request));
+    }
+    m_cond.notify_one();
+
+    return 1;
+}
+
+void RegServer::take_served_connections(void)
+{
+    std::vector<std::pair<int, bool>> served;
+    char buf[64];
+
+    while (read(m_wakeup_pipe[0], buf, sizeof(buf)) > 0)
+    {
+        ; // Drains it, since one check of m_served covers all wake-ups so far.
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        served.swap(m_served);
+    }
+
+    for (const auto &s : served)
+    {
+        auto iter = m_conns.find(s.first);
+        Connection &conn = iter->second;
+
+        conn.busy = false;
+        // Bytes received during handling form the next frame, which may be complete already.
+        conn.deadline_ms = conn.buffer.isEmpty() ? 0 : (now_ms() + FRAME_TIMEOUT_MS);
+        if (!s.second || this->dispatch(s.first, conn) < 0)
+        {
+            close(iter->first);
+            m_conns.erase(iter);
+        }
+    }
+}
+
+void RegServer::drop_stale_connections(void)
+{
+    int64_t now = now_ms();
+
+    for (auto iter = m_conns.begin(); m_conns.end() != iter; )
+    {
+        const Connection &conn = iter->second;
+
+        if (conn.busy || 0 == conn.deadline_ms || now < conn.deadline_ms)
+        {
+            ++iter;
+            continue;
+        }
+
+        qtCErrV(::, "Dropped connection %d with a frame incomplete for %d ms", iter->first, FRAME_TIMEOUT_MS);
+        close(iter->first);
+        iter = m_conns.erase(iter);
+    }
+}
+
+void RegServer::worker_loop(void)
+{
+    QT_SET_THREAD_NAME("WORKER");
+
+    while (true)
+    {
+        Request request;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_cond.wait(lock, [this] { return m_stopping || !m_requests.empty(); });
+            if (m_stopping)
+                return;
+
+            request = std::move(m_requests.front());
+            m_requests.pop_front();
+        }
+
+        QJsonParseError err;
+        const QJsonDocument &doc = QJsonDocument::fromJson(request.payload, &err);
+        bool ok = (QJsonParseError::NoError == err.error && doc.isObject())
+            ? write_frame(request.conn_fd, this->handle(doc.object()), FRAME_TIMEOUT_MS)
+            : write_frame(request.conn_fd, error_response(EINVAL, QString("Bad request: ") + err.errorString()),
+                FRAME_TIMEOUT_MS);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            m_served.push_back({ request.conn_fd, ok });
+        }
+
+        // A full pipe means the polling thread is to wake up anyway.
+        if (write(m_wakeup_pipe[1], "", 1) < 0 && EAGAIN != errno)
+            qtCErrV(::, "Failed to wake up the polling thread: %s", strerror(errno));
+    }
+}
+
+QJsonObject RegServer::handle(const QJsonObject &request)
+{
+    const QString &op = request.value("op").toString();
+    QString path = request.value("file").toString();
+    QString err_msg;
+
+    if (path.isEmpty())
+        return error_response(EINVAL, "No configuration file specified");
+
+    if (!path.startsWith('/'))
+        path.prepend(QString::fromStdString(m_config_dir) + "/");
+
+    std::shared_ptr<const RegConfig> config = m_cache.get(path, &err_msg);
+
+    if (!config)
+        return error_response(ENOENT, err_msg);
+
+    int delim_index = (0 == request.value("delimiter").toString().compare("square", Qt::CaseInsensitive))
+        ? SQUARE_BRACKETS : CURLY_BRACES;
+    const QString &method_str = request.value("addr_base_method").toString("ignore");
+    AddrBaseMethod method = parse_addr_base_method(method_str);
+    const std::string &addr_base_str = request.value("addr_base").toString("0").toStdString();
+    char *end_ptr;
+    uint64_t addr_base = strtoull(addr_base_str.c_str(), &end_ptr, 16);
+
+    if (ADDR_BASE_UNKNOWN == method)
+        return error_response(EINVAL, "Invalid address base method: " + method_str);
+
+    if (addr_base_str.empty() || '\0' != *end_ptr)
+        return error_response(EINVAL, "Invalid address base: " + QString::fromStdString(addr_base_str));
+
+    if ("encode" == op)
+    {
+        RegEncoder encoder(*config);
+        const QStringList &lines = request.value("text").toString().split('\n');
+        QStringList errors;
+
+        for (int i = 0; i < lines.size(); ++i)
+        {
+            if (encoder.assign(lines[i], &err_msg) < 0)
+                errors << QString::asprintf("line %d: ", i + 1) + err_msg;
+        }
+
+        if (!errors.isEmpty())
+            return error_response(EINVAL, errors.join("\n"));
+
+        return QJsonObject({ { "status", 0 }, { "result", encoder.generate(delim_index, method, addr_base) } });
+    }
+
+    if ("decode" != op && "diff" != op)
+        return error_response(ENOTSUP, "Unsupported op: " + op);
+
+    const QString &module_name = request.value("module").toString();
+    RegDecoder decoder(*config, module_name, method, addr_base);
+
+    if (!decoder.valid())
+        return error_response(ENOENT, "Cannot find module: " + module_name);
+
+    if ("decode" == op)
+    {
+        std::vector<RegArrayItem> items;
+
+        if (parse_register_array_items(request.value("text").toString().toStdString().c_str(),
+            delim_index, items, &err_msg) < 0)
+        {
+            return error_response(EINVAL, err_msg);
+        }
+
+        return QJsonObject({ { "status", 0 }, { "result", decoder.decode(items) } });
+    }
+
+    std::vector<RegArrayItem> old_items;
+    std::vector<RegArrayItem> new_items;
+
+    if (parse_register_array_items(request.value("old").toString().toStdString().c_str(),
+            delim_index, old_items, &err_msg) < 0
+        || parse_register_array_items(request.value("new").toString().toStdString().c_str(),
+            delim_index, new_items, &err_msg) < 0)
+    {
+        return error_response(EINVAL, err_msg);
+    }
+
+    return QJsonObject({ { "status", 0 }, { "result", decoder.diff(old_items, new_items) } });
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Receive frames of all connections in the polling thread and hand each complete one
+ *      to workers, instead of tying a worker to a connection for its whole life.
+ *  03. Drop connections with frames incomplete for FRAME_TIMEOUT_MS, and wait for peers
+ *      to receive responses within it as well, so that no worker blocks shutdown forever.
+ */
+
@@ -0,0 +1,153 @@
+/*
+ * Long-running headless server of register decoding/encoding over a Unix domain socket.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_SERVER_HPP__
+#define __REG_SERVER_HPP__
+
+#include <signal.h>
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include <QByteArray>
+#include <QJsonObject>
+
+#include "reg_schema.hpp"
+
+/*
+ * Each frame consists of a 4-byte payload length in big-endian and a UTF-8 JSON object,
+ * and a connection can carry any number of request-response frame pairs.
+ *
+ * Frames of all connections are received by the polling thread, and each complete one is handed
+ * to the worker pool as a request, so idle connections occupy no worker. Requests of one connection
+ * are handled one after another, and a connection with a frame incomplete for 5 seconds is dropped.
+ *
+ * Requests:
+ *
+ *   { "op": "decode", "file": "rockchip/rk3588/mipi.json", "module": "MIPI CSI HOST",
+ *     "delimiter": "curly", "addr_base_method": "ignore", "addr_base": "0", "text": "{ 0x0004, 0x3 }," }
+ *
+ *   { "op": "encode", "file": "rockchip/rk3588/mipi.json",
+ *     "delimiter": "curly", "addr_base_method": "ignore", "addr_base": "0",
+ *     "text": "\"MIPI CSI HOST\".N_LANES.n_lanes = 3" }
+ *
+ *   { "op": "diff", "file": "rockchip/rk3588/mipi.json", "module": "MIPI CSI HOST",
+ *     "delimiter": "curly", "addr_base_method": "ignore", "addr_base": "0", "old": "...", "new": "..." }
+ *
+ * in which "file" is relative to the configuration directory unless it's an absolute path,
+ * "module" is empty or absent for looking up all modules by absolute addresses,
+ * and "delimiter", "addr_base_method", "addr_base" are optional with the same meanings as command line options.
+ *
+ * Responses:
+ *
+ *   { "status": 0, "result": ... } on success, where "result" is an array (see reg_decoder.hpp) for "decode" and "diff",
+ *   or a string of register array items for "encode".
+ *
+ *   { "status": errno, "error": "..." } on failure.
+ */
+class RegServer
+{
+private:
+    RegServer(const RegServer &) = delete;
+    RegServer& operator=(const RegServer &) = delete;
+
+public:
+    RegServer() = delete;
+
+    RegServer(const std::string &config_dir, const std::string &socket_path, int worker_count);
+
+    ~RegServer();
+
+public:
+    // Blocks until stop() is called. Returns 0 on normal exit, or a negative errno.
+    int run(void);
+
+    // Async-signal-safe.
+    static inline void stop(void)
+    {
+        s_stop_requested = 1;
+    }
+
+    static inline bool stop_requested(void)
+    {
+        return s_stop_requested;
+    }
+
+private:
+    struct Connection
+    {
+        QByteArray buffer; // received bytes of frames not handed to workers yet
+        int64_t deadline_ms; // by which the partial frame in buffer must be completed, or 0 if there's none
+        bool busy; // with a request being handled by a worker, and thus not polled
+    };
+
+    struct Request
+    {
+        int conn_fd;
+        QByteArray payload;
+    };
+
+    void worker_loop(void);
+
+    // Returns -1 if the connection is to be closed, or 0 otherwise.
+    int receive(int conn_fd, Connection &conn);
+
+    // Returns 1 if a complete frame is handed to workers, 0 if more bytes are needed, or -1 on an invalid frame.
+    int dispatch(int conn_fd, Connection &conn);
+
+    void take_served_connections(void);
+
+    void drop_stale_connections(void);
+
+    QJsonObject handle(const QJsonObject &request);
+
+private:
+    static volatile sig_atomic_t s_stop_requested;
+
+    std::string m_config_dir;
+    std::string m_socket_path;
+    int m_worker_count;
+    RegConfigCache m_cache;
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<Request> m_requests; // complete frames waiting for a worker
+    std::vector<std::pair<int, bool>> m_served; // connections whose requests are handled, and whether to keep them
+    int m_wakeup_pipe[2]; // written by workers to wake up the polling thread for m_served
+    std::map<int, Connection> m_conns; // touched by the polling thread only
+    bool m_stopping;
+};
+
+#endif /* #ifndef __REG_SERVER_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Hand out work per request instead of per connection, and drop connections
+ *      with frames incomplete for too long.
+ */
+
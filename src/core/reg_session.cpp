@@ -0,0 +1,385 @@
+/*
+ * Snapshot of GUI sessions in a compact binary format, and its autosaver.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_session.hpp"
+
+#include <errno.h>
+#include <string.h>
+
+#include <map>
+
+#include <QFile>
+#include <QSaveFile>
+
+#include "qt_print.hpp"
+
+#define SESSION_MAGIC                   "RPSES\0\0\0"
+#define SESSION_VERSION                 1
+
+static inline void append_u32(std::string &buf, uint32_t val)
+{
+    char bytes[4] = { char(val), char(val >> 8), char(val >> 16), char(val >> 24) };
+
+    buf.append(bytes, sizeof(bytes));
+}
+
+static inline void append_u64(std::string &buf, uint64_t val)
+{
+    append_u32(buf, static_cast<uint32_t>(val));
+    append_u32(buf, static_cast<uint32_t>(val >> 32));
+}
+
+static inline void append_string(std::string &buf, const QString &str)
+{
+    const QByteArray &bytes = str.toUtf8();
+
+    append_u32(buf, static_cast<uint32_t>(bytes.size()));
+    buf.append(bytes.constData(), bytes.size());
+}
+
+namespace
+{
+
+// Every read is bounds-checked, and fails all the following ones once it fails.
+class SnapshotReader
+{
+public:
+    SnapshotReader(const char *data, size_t size)
+        : m_ptr(reinterpret_cast<const uint8_t *>(data))
+        , m_end(reinterpret_cast<const uint8_t *>(data) + size)
+        , m_ok(true)
+    {
+    }
+
+    inline bool ok(void) const
+    {
+        return m_ok;
+    }
+
+    inline bool at_end(void) const
+    {
+        return m_ptr == m_end;
+    }
+
+    bool skip(size_t n)
+    {
+        if (!m_ok || static_cast<size_t>(m_end - m_ptr) < n)
+            return (m_ok = false);
+
+        m_ptr += n;
+
+        return true;
+    }
+
+    uint32_t u32(void)
+    {
+        const uint8_t *p = m_ptr;
+
+        if (!this->skip(4))
+            return 0;
+
+        return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    uint64_t u64(void)
+    {
+        uint64_t low = this->u32();
+
+        return low | (static_cast<uint64_t>(this->u32()) << 32);
+    }
+
+    QString string(void)
+    {
+        uint32_t len = this->u32();
+        const uint8_t *p = m_ptr;
+
+        if (!this->skip(len))
+            return QString();
+
+        return QString::fromUtf8(reinterpret_cast<const char *>(p), len);
+    }
+
+private:
+    const uint8_t *m_ptr;
+    const uint8_t *m_end;
+    bool m_ok;
+};
+
+} // namespace
+
+std::string serialize_reg_session(const RegSession &session)
+{
+    std::string buf(SESSION_MAGIC, 8);
+    std::map<QString, uint32_t> module_ids;
+    std::vector<const QString *> modules;
+
+    for (const auto &item : session.items)
+    {
+        if (module_ids.insert({ item.module, static_cast<uint32_t>(modules.size()) }).second)
+            modules.push_back(&item.module);
+    }
+
+    append_u32(buf, SESSION_VERSION);
+
+    append_string(buf, session.vendor);
+    append_string(buf, session.chip);
+    append_string(buf, session.file);
+    append_string(buf, session.module);
+
+    append_u32(buf, static_cast<uint32_t>(session.tab_index));
+    append_u32(buf, session.as_input ? 1 : 0);
+    append_u32(buf, static_cast<uint32_t>(session.delim_index));
+    append_string(buf, session.addr_base_method);
+    append_u64(buf, session.addr_base);
+    append_string(buf, session.input_text);
+    append_u32(buf, static_cast<uint32_t>(session.scroll_pos));
+
+    append_u32(buf, static_cast<uint32_t>(modules.size()));
+    for (const QString *module : modules)
+    {
+        append_string(buf, *module);
+    }
+
+    append_u32(buf, static_cast<uint32_t>(session.items.size()));
+    for (const auto &item : session.items)
+    {
+        append_u32(buf, module_ids[item.module]);
+        append_u64(buf, item.module_base);
+        append_u64(buf, item.value);
+        append_string(buf, item.reg_key);
+    }
+
+    return buf;
+}
+
+int parse_reg_session(const char *data, size_t size, RegSession &session, QString *err_msg/* = nullptr */)
+{
+    SnapshotReader reader(data, size);
+
+    if (size < 8 || 0 != memcmp(data, SESSION_MAGIC, 8))
+    {
+        if (err_msg)
+            *err_msg = "Not a session snapshot";
+
+        return -EINVAL;
+    }
+    reader.skip(8);
+
+    uint32_t version = reader.u32();
+
+    if (SESSION_VERSION != version)
+    {
+        if (err_msg)
+            *err_msg = QString::asprintf("Unsupported version of session snapshot: %u", version);
+
+        return -ENOTSUP;
+    }
+
+    RegSession result;
+
+    result.vendor = reader.string();
+    result.chip = reader.string();
+    result.file = reader.string();
+    result.module = reader.string();
+
+    result.tab_index = static_cast<int32_t>(reader.u32());
+    result.as_input = (reader.u32() & 0x1);
+    result.delim_index = static_cast<int32_t>(reader.u32());
+    result.addr_base_method = reader.string();
+    result.addr_base = reader.u64();
+    result.input_text = reader.string();
+    result.scroll_pos = static_cast<int32_t>(reader.u32());
+
+    uint32_t module_count = reader.u32();
+    std::vector<QString> modules;
+
+    // Each string takes 4 bytes at least, which rejects a corrupted count before allocating memory for it.
+    if (module_count > size / 4)
+        reader.skip(size); // fails it
+
+    for (uint32_t i = 0; i < module_count && reader.ok(); ++i)
+    {
+        modules.push_back(reader.string());
+    }
+
+    uint32_t item_count = reader.u32();
+
+    // Each item takes 24 bytes at least.
+    if (reader.ok() && item_count <= size / 24)
+        result.items.reserve(item_count);
+
+    for (uint32_t i = 0; i < item_count && reader.ok(); ++i)
+    {
+        uint32_t module_index = reader.u32();
+        uint64_t module_base = reader.u64();
+        uint64_t value = reader.u64();
+        QString reg_key = reader.string();
+
+        if (module_index >= modules.size())
+        {
+            reader.skip(size); // fails it
+            break;
+        }
+
+        result.items.push_back({ modules[module_index], reg_key, module_base, value });
+    }
+
+    if (!reader.ok() || !reader.at_end())
+    {
+        if (err_msg)
+            *err_msg = "Truncated or corrupted session snapshot";
+
+        return -EINVAL;
+    }
+
+    session = std::move(result);
+
+    return 0;
+}
+
+static int write_snapshot(const QString &path, const std::string &buf, QString *err_msg)
+{
+    QSaveFile file(path);
+
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(buf.data(), buf.size()) != static_cast<qint64>(buf.size())
+        || !file.commit())
+    {
+        if (err_msg)
+            *err_msg = QString("Failed to write file: ") + path + ", reason: " + file.errorString();
+
+        return -EIO;
+    }
+
+    return 0;
+}
+
+int save_reg_session(const QString &path, const RegSession &session, QString *err_msg/* = nullptr */)
+{
+    return write_snapshot(path, serialize_reg_session(session), err_msg);
+}
+
+int load_reg_session(const QString &path, RegSession &session, QString *err_msg/* = nullptr */)
+{
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        if (err_msg)
+            *err_msg = QString("Failed to read file: ") + path + ", reason: " + file.errorString();
+
+        return -ENOENT;
+    }
+
+    const QByteArray &bytes = file.readAll();
+
+    return parse_reg_session(bytes.constData(), bytes.size(), session, err_msg);
+}
+
+/******************************** RegSessionAutosaver begin ********************************/
+
+RegSessionAutosaver::RegSessionAutosaver()
+    : m_stopping(false)
+{
+}
+
+RegSessionAutosaver::~RegSessionAutosaver()
+{
+    this->stop();
+}
+
+void RegSessionAutosaver::start(const QString &path)
+{
+    this->stop();
+
+    m_path = path;
+    m_stopping = false;
+    m_last_written.clear();
+    m_writer = std::thread(&RegSessionAutosaver::run, this);
+}
+
+void RegSessionAutosaver::stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_stopping = true;
+    }
+    m_cond.notify_one();
+
+    if (m_writer.joinable())
+        m_writer.join();
+}
+
+void RegSessionAutosaver::submit(const RegSession &session)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_pending.reset(new RegSession(session));
+    }
+    m_cond.notify_one();
+}
+
+void RegSessionAutosaver::run(void)
+{
+    while (true)
+    {
+        std::unique_ptr<RegSession> session;
+        bool stopping;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_cond.wait(lock, [this]() { return m_stopping || m_pending; });
+            session = std::move(m_pending);
+            stopping = m_stopping;
+        }
+
+        if (session)
+        {
+            std::string buf = serialize_reg_session(*session);
+            QString err_msg;
+
+            if (buf == m_last_written)
+                qtCDebugV(::, "Session unchanged, skipped.");
+            else if (write_snapshot(m_path, buf, &err_msg) < 0)
+                qtCErrV(::, "%s", err_msg.toStdString().c_str());
+            else
+            {
+                qtCDebugV(::, "Session saved: %s (%lu bytes)", m_path.toStdString().c_str(), buf.size());
+                m_last_written.swap(buf);
+            }
+        }
+
+        if (stopping)
+            break;
+    }
+}
+
+/******************************** RegSessionAutosaver end ********************************/
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
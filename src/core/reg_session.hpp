@@ -0,0 +1,133 @@
+/*
+ * Snapshot of GUI sessions in a compact binary format, and its autosaver.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_SESSION_HPP__
+#define __REG_SESSION_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include <QString>
+
+struct RegSessionItem
+{
+    QString module;
+    QString reg_key;
+    uint64_t module_base;
+    uint64_t value;
+};
+
+struct RegSession
+{
+    QString vendor;
+    QString chip;
+    QString file;
+    QString module;
+    int tab_index;
+    bool as_input;
+    int delim_index;
+    QString addr_base_method;
+    uint64_t addr_base;
+    QString input_text;
+    int scroll_pos;
+    std::vector<RegSessionItem> items; // register tables shown, in order
+};
+
+/*
+ * Snapshot format (all integers in little-endian):
+ *
+ *   header:     "RPSES\0\0\0", u32 version(1)
+ *   selection:  vendor, chip, file, module as strings
+ *   view:       i32 tab index, u32 flags(bit 0: as input), i32 delimiter index,
+ *               string of address base method, u64 address base, string of input text, i32 scroll position
+ *   dictionary: u32 string count, then each module name as a string
+ *   items:      u32 item count, then each item as u32 module index of the dictionary,
+ *               u64 module base, u64 value and string of register key
+ *
+ * where each string is a u32 length plus UTF-8 bytes without terminator.
+ */
+std::string serialize_reg_session(const RegSession &session);
+
+// Returns 0 on success, or a negative errno on format errors or unsupported versions.
+int parse_reg_session(const char *data, size_t size, RegSession &session, QString *err_msg = nullptr);
+
+// Writes via a temporary file, so that a crash in between never leaves a corrupted snapshot.
+int save_reg_session(const QString &path, const RegSession &session, QString *err_msg = nullptr);
+
+int load_reg_session(const QString &path, RegSession &session, QString *err_msg = nullptr);
+
+/*
+ * Sessions captured by the GUI thread are handed over to a background thread, which serializes
+ * and writes them only if they differ from the last one written. Only the newest pending one
+ * is kept, so a slow disk never queues up stale snapshots.
+ */
+class RegSessionAutosaver
+{
+private:
+    RegSessionAutosaver(const RegSessionAutosaver &) = delete;
+    RegSessionAutosaver& operator=(const RegSessionAutosaver &) = delete;
+
+public:
+    RegSessionAutosaver();
+
+    ~RegSessionAutosaver(); // pending session flushed
+
+public:
+    void start(const QString &path);
+
+    // Writes the pending session if any, and stops the background thread.
+    void stop(void);
+
+    void submit(const RegSession &session);
+
+    inline const QString& path(void) const
+    {
+        return m_path;
+    }
+
+private:
+    void run(void);
+
+private:
+    QString m_path;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::thread m_writer;
+    std::unique_ptr<RegSession> m_pending;
+    bool m_stopping;
+    std::string m_last_written;
+};
+
+#endif /* #ifndef __REG_SESSION_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
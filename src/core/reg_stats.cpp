@@ -0,0 +1,267 @@
+/*
+ * Per-field value histograms and anomaly report across register dumps.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_stats.hpp"
+
+#include <errno.h>
+
+#include <atomic>
+#include <algorithm>
+
+#include <QFile>
+#include <QJsonArray>
+
+#include "qt_print.hpp"
+#include "reg_decoder.hpp"
+#include "work_pool.hpp"
+
+RegFieldStats::RegFieldStats(const RegConfig &config, const QString &module_name,
+    int delim_index, AddrBaseMethod method, uint64_t addr_base)
+    : m_config(config)
+    , m_module_name(module_name)
+    , m_delim_index(delim_index)
+    , m_method(method)
+    , m_addr_base(addr_base)
+    , m_dump_count(0)
+    , m_fail_count(0)
+{
+    for (const auto &module : m_config.modules)
+    {
+        for (const auto &reg : module->registers)
+        {
+            m_first_slots[&reg] = m_slots.size();
+            for (size_t i = 0; i < reg.fields.size(); ++i)
+            {
+                m_slots.push_back({ module.get(), &reg, i, 0 });
+            }
+        }
+    }
+}
+
+void RegFieldStats::count_value(Histogram &histogram, uint64_t value, uint64_t count,
+    const std::vector<uint32_t> &samples)
+{
+    ValueStat &stat = histogram[value];
+
+    stat.count += count;
+    for (uint32_t dump_index : samples)
+    {
+        if (stat.samples.size() < MAX_SAMPLE_DUMPS)
+        {
+            stat.samples.push_back(dump_index);
+            continue;
+        }
+
+        auto max_iter = std::max_element(stat.samples.begin(), stat.samples.end());
+
+        if (dump_index < *max_iter)
+            *max_iter = dump_index;
+    }
+}
+
+int RegFieldStats::run(const std::vector<std::string> &dump_files, int worker_count)
+{
+    RegDecoder decoder(m_config, m_module_name, m_method, m_addr_base);
+
+    if (!decoder.valid())
+    {
+        qtCErrV(::, "Cannot find module: %s", m_module_name.toStdString().c_str());
+
+        return -ENOENT;
+    }
+
+    WorkStealingPool pool(worker_count);
+    std::vector<std::vector<Histogram>> local_histograms(pool.worker_count(), std::vector<Histogram>(m_slots.size()));
+    std::vector<std::vector<uint64_t>> local_totals(pool.worker_count(), std::vector<uint64_t>(m_slots.size(), 0));
+    std::atomic<int> fail_count(0);
+
+    pool.run(dump_files.size(), [&](size_t task_index, int worker_index) {
+        const std::string &path = dump_files[task_index];
+        QFile file(QString::fromStdString(path));
+        std::vector<RegArrayItem> items;
+        QString err_msg;
+
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            qtCErrV(::, "Failed to read file: %s, reason: %s", path.c_str(), file.errorString().toStdString().c_str());
+            ++fail_count;
+
+            return;
+        }
+
+        if (parse_register_array_items(file.readAll().constData(), m_delim_index, items, &err_msg) < 0)
+        {
+            qtCErrV(::, "%s: %s", path.c_str(), err_msg.toStdString().c_str());
+            ++fail_count;
+
+            return;
+        }
+
+        std::vector<Histogram> &histograms = local_histograms[worker_index];
+        std::vector<uint64_t> &totals = local_totals[worker_index];
+        const std::vector<uint32_t> sample(1, static_cast<uint32_t>(task_index));
+
+        for (const auto &item : items)
+        {
+            const RegModule *module = nullptr;
+            const RegInfo *reg = decoder.find_register(item.addr, &module);
+
+            if (nullptr == reg)
+            {
+                qtCDebugV(::, "%s: No such a register with address = 0x%lx", path.c_str(), item.addr);
+                continue;
+            }
+
+            size_t first_slot = m_first_slots.at(reg);
+
+            for (size_t i = 0; i < reg->fields.size(); ++i)
+            {
+                count_value(histograms[first_slot + i], reg->fields[i].extract(item.value), 1, sample);
+                ++totals[first_slot + i];
+            }
+        }
+    });
+
+    m_histograms.assign(m_slots.size(), Histogram());
+    for (auto &slot : m_slots)
+    {
+        slot.total = 0;
+    }
+
+    for (size_t w = 0; w < local_histograms.size(); ++w)
+    {
+        for (size_t i = 0; i < m_slots.size(); ++i)
+        {
+            for (const auto &pair : local_histograms[w][i])
+            {
+                count_value(m_histograms[i], pair.first, pair.second.count, pair.second.samples);
+            }
+            m_slots[i].total += local_totals[w][i];
+        }
+        std::vector<Histogram>().swap(local_histograms[w]);
+    }
+
+    m_dump_files = dump_files;
+    m_fail_count = fail_count;
+    m_dump_count = dump_files.size() - m_fail_count;
+
+    return m_fail_count;
+}
+
+QJsonObject RegFieldStats::report(bool all_fields) const
+{
+    QJsonArray fields;
+
+    for (size_t i = 0; i < m_histograms.size(); ++i)
+    {
+        const FieldSlot &slot = m_slots[i];
+        const RegField &field = slot.reg->fields[slot.field_index];
+        const Histogram &histogram = m_histograms[i];
+        uint64_t default_value = field.extract(slot.reg->default_value);
+
+        if (histogram.empty())
+            continue;
+
+        std::vector<std::pair<uint64_t, const ValueStat *>> values;
+
+        values.reserve(histogram.size());
+        for (const auto &pair : histogram)
+        {
+            values.push_back({ pair.first, &pair.second });
+        }
+        // The smaller value wins a tie for a stable majority.
+        std::sort(values.begin(), values.end(), [](const std::pair<uint64_t, const ValueStat *> &a,
+            const std::pair<uint64_t, const ValueStat *> &b) {
+            return (a.second->count != b.second->count) ? (a.second->count > b.second->count) : (a.first < b.first);
+        });
+
+        uint64_t majority = values.front().first;
+        bool non_default = (values.size() > 1 || majority != default_value);
+        bool non_unanimous = (values.size() > 1);
+
+        if (!all_fields && !non_default && !non_unanimous)
+            continue;
+
+        QJsonArray flags;
+        QJsonArray value_list;
+
+        if (non_default)
+            flags.append("non-default");
+        if (non_unanimous)
+            flags.append("non-unanimous");
+
+        for (const auto &pair : values)
+        {
+            QJsonObject value_item;
+            const QString &label = field_value_label(field, pair.first);
+
+            value_item.insert("value", QString::asprintf("0x%lx", pair.first));
+            if (!label.isEmpty())
+                value_item.insert("label", label);
+            value_item.insert("count", static_cast<qint64>(pair.second->count));
+
+            if (pair.first != majority || pair.first != default_value)
+            {
+                std::vector<uint32_t> samples(pair.second->samples);
+                QJsonArray dumps;
+
+                std::sort(samples.begin(), samples.end());
+                for (uint32_t dump_index : samples)
+                {
+                    dumps.append(QString::fromStdString(m_dump_files[dump_index]));
+                }
+                value_item.insert("dumps", dumps);
+            }
+
+            value_list.append(value_item);
+        }
+
+        QJsonObject item;
+
+        item.insert("module", slot.module->name);
+        item.insert("register", slot.reg->key);
+        item.insert("bits", field.range);
+        item.insert("name", field.name());
+        item.insert("total", static_cast<qint64>(slot.total));
+        item.insert("default", QString::asprintf("0x%lx", default_value));
+        item.insert("majority", QString::asprintf("0x%lx", majority));
+        item.insert("flags", flags);
+        item.insert("values", value_list);
+
+        fields.append(item);
+    } // for (i : m_histograms.size())
+
+    QJsonObject result;
+
+    result.insert("dumps", static_cast<qint64>(m_dump_count));
+    result.insert("failed", m_fail_count);
+    result.insert("fields", fields);
+
+    return result;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Access compiled modules via shared pointers.
+ */
+
@@ -0,0 +1,118 @@
+/*
+ * Per-field value histograms and anomaly report across register dumps.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_STATS_HPP__
+#define __REG_STATS_HPP__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <QString>
+#include <QJsonObject>
+
+#include "reg_schema.hpp"
+#include "reg_codec.hpp"
+
+/*
+ * Dumps are streamed through worker-local histograms and dropped right after being counted,
+ * so memory is bounded by (fields x distinct values) rather than by the size of corpus.
+ *
+ * Report format:
+ *
+ * {
+ *   "dumps": 1000, "failed": 0,
+ *   "fields": [
+ *     {
+ *       "module": "MIPI CSI HOST", "register": "0x0004 | N_LANES", "bits": "1:0", "name": "n_lanes",
+ *       "total": 1000, "default": "0x3", "majority": "0x3", "flags": [ "non-default", "non-unanimous" ],
+ *       "values": [
+ *         { "value": "0x3", "label": "4 data lanes(ALL)", "count": 999 },
+ *         { "value": "0x1", "label": "2 data lanes", "count": 1, "dumps": [ "boards/0042.txt" ] }
+ *       ]
+ *     }, ...
+ *   ]
+ * }
+ *
+ * where "total" is the number of dumps containing the register, values are sorted by count in descending order,
+ * and "dumps" lists at most MAX_SAMPLE_DUMPS samples for each value unless it's both the majority and the default.
+ * Only flagged fields are listed unless all fields are requested.
+ */
+class RegFieldStats
+{
+public:
+    static const size_t MAX_SAMPLE_DUMPS = 8;
+
+    RegFieldStats() = delete;
+
+    // All modules with "__base__" are looked up by absolute addresses if module_name is empty.
+    RegFieldStats(const RegConfig &config, const QString &module_name,
+        int delim_index, AddrBaseMethod method, uint64_t addr_base);
+
+public:
+    // Returns the number of dumps failed to read or parse, or a negative errno if module is not found.
+    int run(const std::vector<std::string> &dump_files, int worker_count);
+
+    QJsonObject report(bool all_fields) const;
+
+private:
+    struct ValueStat
+    {
+        uint64_t count;
+        std::vector<uint32_t> samples; // indexes of dump files, the smallest ones kept
+    };
+
+    typedef std::unordered_map<uint64_t, ValueStat> Histogram;
+
+    struct FieldSlot
+    {
+        const RegModule *module;
+        const RegInfo *reg;
+        size_t field_index;
+        uint64_t total;
+    };
+
+    static void count_value(Histogram &histogram, uint64_t value, uint64_t count, const std::vector<uint32_t> &samples);
+
+private:
+    const RegConfig &m_config;
+    QString m_module_name;
+    int m_delim_index;
+    AddrBaseMethod m_method;
+    uint64_t m_addr_base;
+    std::vector<FieldSlot> m_slots;
+    std::unordered_map<const RegInfo *, size_t> m_first_slots;
+    std::vector<Histogram> m_histograms;
+    std::vector<std::string> m_dump_files;
+    size_t m_dump_count;
+    int m_fail_count;
+};
+
+#endif /* #ifndef __REG_STATS_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
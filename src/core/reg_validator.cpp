@@ -0,0 +1,138 @@
+/*
+ * Validation of register values against access masks and enum sets.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "reg_validator.hpp"
+
+#include "reg_decoder.hpp"
+
+QString reg_issue_text(const RegIssue &issue)
+{
+    const RegField *field = issue.field;
+
+    switch (issue.type)
+    {
+    case REG_ISSUE_RESERVED_BITS:
+        if (nullptr == field)
+            return QString::asprintf("undescribed bits: 0x%lx written", issue.bits);
+
+        return QString::asprintf("bits[%s] reserved: 0x%lx written",
+            field->range.toStdString().c_str(), field->extract(issue.bits));
+
+    case REG_ISSUE_READONLY_BITS:
+        return QString::asprintf("%s[%s] read-only: 0x%lx written", field->name().toStdString().c_str(),
+            field->range.toStdString().c_str(), field->extract(issue.bits));
+
+    case REG_ISSUE_ILLEGAL_VALUE:
+        return QString::asprintf("%s[%s]: illegal value 0x%lx", field->name().toStdString().c_str(),
+            field->range.toStdString().c_str(), issue.bits);
+
+    default:
+        return "unknown issue";
+    }
+}
+
+size_t validate_register_value(const RegInfo &reg, uint64_t value, size_t item_index, std::vector<RegIssue> &issues)
+{
+    size_t old_count = issues.size();
+    uint64_t changed_bits = value ^ reg.default_value;
+    uint64_t reserved_bits = changed_bits & reg.reserved_mask;
+    uint64_t readonly_bits = changed_bits & reg.ro_mask;
+
+    if (reserved_bits || readonly_bits)
+    {
+        for (const auto &field : reg.fields)
+        {
+            uint64_t mask = field.mask();
+
+            if (reserved_bits & mask)
+            {
+                issues.push_back({ item_index, REG_ISSUE_RESERVED_BITS, &reg, &field, reserved_bits & mask });
+                reserved_bits &= ~mask;
+            }
+            else if ((readonly_bits & mask) && BITS_ITEM_DESC_RESERVED != field.desc_type)
+                issues.push_back({ item_index, REG_ISSUE_READONLY_BITS, &reg, &field, readonly_bits & mask });
+            else
+            {
+                ; // nothing but for the sake of Code of Conduct
+            }
+        }
+
+        if (reserved_bits) // not covered by any field
+            issues.push_back({ item_index, REG_ISSUE_RESERVED_BITS, &reg, nullptr, reserved_bits });
+    }
+
+    for (size_t i : reg.enum_fields)
+    {
+        const RegField &field = reg.fields[i];
+        uint64_t bits_value = field.extract(value);
+
+        if (!field.is_legal(bits_value))
+            issues.push_back({ item_index, REG_ISSUE_ILLEGAL_VALUE, &reg, &field, bits_value });
+    }
+
+    return issues.size() - old_count;
+}
+
+size_t validate_register_items(const RegDecoder &decoder, const std::vector<RegArrayItem> &items,
+    std::vector<RegIssue> &issues)
+{
+    size_t count = items.size();
+    std::vector<const RegInfo *> regs(count, nullptr);
+    std::vector<uint64_t> changed_bits(count, 0);
+    std::vector<uint64_t> forbidden_masks(count, 0);
+    std::vector<uint8_t> suspects(count, 0);
+    size_t old_count = issues.size();
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const RegModule *module = nullptr;
+        const RegInfo *reg = decoder.find_register(items[i].addr, &module);
+
+        if (nullptr == reg)
+            continue;
+
+        regs[i] = reg;
+        changed_bits[i] = items[i].value ^ reg->default_value;
+        forbidden_masks[i] = reg->reserved_mask | reg->ro_mask;
+        suspects[i] = reg->enum_fields.empty() ? 0 : 1;
+    }
+
+    // Branch-free, so that compilers are free to vectorize it.
+    for (size_t i = 0; i < count; ++i)
+    {
+        suspects[i] |= ((changed_bits[i] & forbidden_masks[i]) != 0);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (suspects[i])
+            validate_register_value(*regs[i], items[i].value, i, issues);
+    }
+
+    return issues.size() - old_count;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,75 @@
+/*
+ * Validation of register values against access masks and enum sets.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __REG_VALIDATOR_HPP__
+#define __REG_VALIDATOR_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include <QString>
+
+#include "reg_schema.hpp"
+#include "reg_codec.hpp"
+
+class RegDecoder;
+
+enum RegIssueType
+{
+    REG_ISSUE_RESERVED_BITS, // reserved bits differ from default
+    REG_ISSUE_READONLY_BITS, // read-only bits differ from default
+    REG_ISSUE_ILLEGAL_VALUE, // value out of the enum set
+};
+
+struct RegIssue
+{
+    size_t item_index; // index of the register array items
+    RegIssueType type;
+    const RegInfo *reg;
+    const RegField *field; // nullptr for reserved bits not covered by any field
+    uint64_t bits; // offending bits of the full value, or the field value for REG_ISSUE_ILLEGAL_VALUE
+};
+
+// e.g.: "bits[31:4] reserved: 0x30 written", "n_lanes[1:0]: illegal value 0x2"
+QString reg_issue_text(const RegIssue &issue);
+
+// Validates the value of one register. Returns the number of issues appended.
+size_t validate_register_value(const RegInfo &reg, uint64_t value, size_t item_index, std::vector<RegIssue> &issues);
+
+/*
+ * Validates all items whose addresses are resolvable by the decoder, and skips the rest.
+ * The masks of all items are checked in one flat loop at first, and only the offending ones
+ * are examined field by field afterwards, which keeps it cheap for large init tables.
+ * Returns the number of issues appended.
+ */
+size_t validate_register_items(const RegDecoder &decoder, const std::vector<RegArrayItem> &items,
+    std::vector<RegIssue> &issues);
+
+#endif /* #ifndef __REG_VALIDATOR_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
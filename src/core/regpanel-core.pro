@@ -0,0 +1,17 @@
+MAKEFILE = QtMakefile
+
+TEMPLATE = lib
+TARGET = regpanel-core
+CONFIG += c++11 staticlib warn_on release
+exists(../regpanel.debug.pri) {
+    include(../regpanel.debug.pri) # Should contain: CONFIG += debug
+}
+include(../regpanel-common.pri)
+
+INCLUDEPATH += .. # for qt_print.hpp
+HEADERS += soc_map.hpp reg_schema.hpp reg_codec.hpp reg_encoder.hpp reg_decoder.hpp reg_server.hpp \
+    work_pool.hpp reg_batch.hpp reg_stats.hpp reg_validator.hpp reg_search.hpp reg_filter.hpp \
+    reg_codegen.hpp reg_journal.hpp reg_session.hpp reg_prefetch.hpp reg_archive.hpp reg_lint.hpp
+SOURCES += *.cpp
+QT = core
+
@@ -0,0 +1,142 @@
+/*
+ * SoC-level (global) address map of register modules.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "soc_map.hpp"
+
+#include <QDir>
+#include <QJsonDocument>
+#include <QJsonArray>
+
+#include "qt_print.hpp"
+
+void SocAddrMap::clear(void)
+{
+    m_chip_dir.clear();
+    m_modules.clear();
+    m_tree.clear();
+}
+
+int SocAddrMap::build(const std::string &chip_dir, const std::vector<std::string> &files)
+{
+    this->clear();
+    m_chip_dir = chip_dir;
+
+    for (const auto &file_name : files)
+    {
+        QString path = QString::fromStdString(chip_dir) + QDir::separator() + QString::fromStdString(file_name);
+        QJsonDocument doc;
+        QString err_msg;
+
+        // With inheritance resolved, so that modules of a variant are placed as well.
+        if (read_reg_config_doc(path, doc, &err_msg) < 0)
+        {
+            qtCErrV(::, "%s", err_msg.toStdString().c_str());
+            continue;
+        }
+
+        const QJsonObject &doc_dict = doc.object();
+        int addr_bits = get_bitwidth(doc_dict, "__addr_bits__");
+        int data_bits = get_bitwidth(doc_dict, "__data_bits__");
+
+        for (const auto &m : doc_dict.value("__modules__").toArray())
+        {
+            const QString &module_name = m.toString();
+            const QJsonValue &module_val = doc_dict.value(module_name);
+            uint64_t base;
+
+            if (!module_val.isObject())
+                continue;
+
+            const QJsonObject &modules_dict = module_val.toObject();
+
+            if (!get_module_base(modules_dict, base))
+            {
+                qtCDebugV(::, "%s: Module[%s] has no __base__, skipped.",
+                    file_name.c_str(), module_name.toStdString().c_str());
+                continue;
+            }
+
+            uint64_t size = get_module_size(modules_dict, data_bits);
+
+            if (0 == size)
+                continue;
+
+            m_modules.push_back({ file_name, module_name, modules_dict, base, size, addr_bits, data_bits, {} });
+
+            for (const QString &k : modules_dict.keys())
+            {
+                const std::string &key = k.toStdString();
+
+                if (!k.startsWith("__"))
+                    m_modules.back().reg_addr_map[strtoull(key.c_str(), nullptr, 16)] = key;
+            }
+
+            m_tree.insert(base, (size - 1 > UINT64_MAX - base) ? UINT64_MAX : (base + size - 1), m_modules.size() - 1);
+        }
+    } // for (file_name : files)
+
+    m_tree.build();
+
+    for (const auto &i : m_tree.intervals())
+    {
+        std::vector<const IntervalTree<size_t>::Interval *> overlaps;
+
+        m_tree.find_all(i.low, overlaps);
+        if (overlaps.size() > 1)
+        {
+            qtCErrV(::, "Module[%s] at 0x%lx overlaps with %lu other module(s)!",
+                m_modules[i.data].name.toStdString().c_str(), i.low, overlaps.size() - 1);
+        }
+    }
+
+    return m_modules.size();
+}
+
+const SocAddrMap::Module* SocAddrMap::find_module(uint64_t addr) const
+{
+    const auto *interval = m_tree.find(addr);
+
+    return interval ? &m_modules[interval->data] : nullptr;
+}
+
+const std::string* SocAddrMap::find_register(uint64_t addr, const Module **module) const
+{
+    const Module *m = this->find_module(addr);
+
+    if (module)
+        *module = m;
+
+    if (nullptr == m)
+        return nullptr;
+
+    auto iter = m->reg_addr_map.find(addr - m->base);
+
+    return (m->reg_addr_map.end() == iter) ? nullptr : &iter->second;
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ *  02. Read configuration files via read_reg_config_file() to support the mounted archive.
+ *  03. Read configuration files via read_reg_config_doc() to support inheritance.
+ */
+
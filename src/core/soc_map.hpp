@@ -0,0 +1,226 @@
+/*
+ * SoC-level (global) address map of register modules.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __SOC_MAP_HPP__
+#define __SOC_MAP_HPP__
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include <QJsonObject>
+
+#include "reg_schema.hpp"
+
+/*
+ * A static augmented interval tree.
+ *
+ * Intervals are stored sorted by their low ends, and the tree is implicit:
+ * the node of range [lo, hi) is the middle element, so no pointers are needed.
+ * Each node records the max high end within its subtree to prune the search.
+ * The high end is inclusive, which makes a range ending at UINT64_MAX expressible.
+ */
+template<typename T>
+class IntervalTree
+{
+public:
+    struct Interval
+    {
+        uint64_t low;
+        uint64_t high; // inclusive
+        T data;
+    };
+
+public:
+    inline void clear(void)
+    {
+        m_intervals.clear();
+        m_max_high.clear();
+    }
+
+    inline bool empty(void) const
+    {
+        return m_intervals.empty();
+    }
+
+    inline size_t size(void) const
+    {
+        return m_intervals.size();
+    }
+
+    inline const std::vector<Interval>& intervals(void) const
+    {
+        return m_intervals;
+    }
+
+    // NOTE: Call build() after all insertions, or find*() will not work.
+    inline void insert(uint64_t low, uint64_t high, const T &data)
+    {
+        if (low <= high)
+            m_intervals.push_back({ low, high, data });
+    }
+
+    void build(void)
+    {
+        std::sort(m_intervals.begin(), m_intervals.end(), [](const Interval &a, const Interval &b) {
+            return (a.low != b.low) ? (a.low < b.low) : (a.high < b.high);
+        });
+        m_max_high.assign(m_intervals.size(), 0);
+        build(0, m_intervals.size());
+    }
+
+    // Returns the containing interval with the lowest low end, or nullptr if none.
+    inline const Interval* find(uint64_t point) const
+    {
+        return find(0, m_intervals.size(), point);
+    }
+
+    void find_all(uint64_t point, std::vector<const Interval *> &result) const
+    {
+        find_all(0, m_intervals.size(), point, result);
+    }
+
+private:
+    uint64_t build(size_t lo, size_t hi)
+    {
+        if (lo >= hi)
+            return 0;
+
+        size_t mid = lo + (hi - lo) / 2;
+        uint64_t max_high = m_intervals[mid].high;
+
+        max_high = std::max(max_high, build(lo, mid));
+        max_high = std::max(max_high, build(mid + 1, hi));
+
+        return (m_max_high[mid] = max_high);
+    }
+
+    const Interval* find(size_t lo, size_t hi, uint64_t point) const
+    {
+        while (lo < hi)
+        {
+            size_t mid = lo + (hi - lo) / 2;
+
+            if (m_max_high[mid] < point)
+                return nullptr;
+
+            const Interval *hit = find(lo, mid, point);
+
+            if (hit)
+                return hit;
+
+            if (point < m_intervals[mid].low)
+                return nullptr; // Nothing on the right side starts early enough.
+
+            if (point <= m_intervals[mid].high)
+                return &m_intervals[mid];
+
+            lo = mid + 1;
+        }
+
+        return nullptr;
+    }
+
+    void find_all(size_t lo, size_t hi, uint64_t point, std::vector<const Interval *> &result) const
+    {
+        if (lo >= hi)
+            return;
+
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (m_max_high[mid] < point)
+            return;
+
+        find_all(lo, mid, point, result);
+
+        if (point < m_intervals[mid].low)
+            return;
+
+        if (point <= m_intervals[mid].high)
+            result.push_back(&m_intervals[mid]);
+
+        find_all(mid + 1, hi, point, result);
+    }
+
+private:
+    std::vector<Interval> m_intervals;
+    std::vector<uint64_t> m_max_high;
+};
+
+// NOTE: Only modules with a "__base__" property can be placed into the SoC map.
+class SocAddrMap
+{
+public:
+    struct Module
+    {
+        std::string file; // config file name within the chip directory
+        QString name;
+        QJsonObject dict; // shared with the parsed document, no deep copy
+        uint64_t base;
+        uint64_t size;
+        int addr_bits;
+        int data_bits;
+        std::map<uint64_t, std::string> reg_addr_map; // offset => register key
+    };
+
+public:
+    inline const std::string& chip_dir(void) const
+    {
+        return m_chip_dir;
+    }
+
+    inline const std::vector<Module>& modules(void) const
+    {
+        return m_modules;
+    }
+
+    inline bool empty(void) const
+    {
+        return m_modules.empty();
+    }
+
+    void clear(void);
+
+    // Returns the number of modules placed.
+    int build(const std::string &chip_dir, const std::vector<std::string> &files);
+
+    const Module* find_module(uint64_t addr) const;
+
+    // Returns the register key, or nullptr if no module or register matches.
+    const std::string* find_register(uint64_t addr, const Module **module) const;
+
+private:
+    std::string m_chip_dir;
+    std::vector<Module> m_modules;
+    IntervalTree<size_t> m_tree; // data: index of m_modules
+};
+
+#endif /* #ifndef __SOC_MAP_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
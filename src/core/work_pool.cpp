@@ -0,0 +1,112 @@
+/*
+ * A fork-join thread pool with work stealing.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "work_pool.hpp"
+
+#include <algorithm>
+#include <thread>
+
+WorkStealingPool::WorkStealingPool(int worker_count)
+    : m_worker_count((worker_count > 0) ? worker_count : 1)
+{
+    m_queues.reserve(m_worker_count);
+    for (int i = 0; i < m_worker_count; ++i)
+    {
+        m_queues.emplace_back(new TaskQueue);
+    }
+}
+
+bool WorkStealingPool::pop(int worker_index, size_t &task_index)
+{
+    TaskQueue &queue = *m_queues[worker_index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    if (queue.tasks.empty())
+        return false;
+
+    task_index = queue.tasks.back();
+    queue.tasks.pop_back();
+
+    return true;
+}
+
+bool WorkStealingPool::steal(int thief_index, size_t &task_index)
+{
+    for (int i = 1; i < m_worker_count; ++i)
+    {
+        TaskQueue &victim = *m_queues[(thief_index + i) % m_worker_count];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (victim.tasks.empty())
+            continue;
+
+        task_index = victim.tasks.front();
+        victim.tasks.pop_front();
+
+        return true;
+    }
+
+    return false;
+}
+
+void WorkStealingPool::run(size_t task_count, const task_func_t &func)
+{
+    size_t chunk_size = (task_count + m_worker_count - 1) / m_worker_count;
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < m_worker_count; ++i)
+    {
+        size_t begin = i * chunk_size;
+        size_t end = std::min(begin + chunk_size, task_count);
+
+        // Reversed, so that each worker starts from the beginning of its chunk.
+        for (size_t j = end; j > begin; --j)
+        {
+            m_queues[i]->tasks.push_back(j - 1);
+        }
+    }
+
+    threads.reserve(m_worker_count);
+    for (int i = 0; i < m_worker_count; ++i)
+    {
+        threads.emplace_back([this, i, &func] {
+            size_t task_index;
+
+            // No more tasks are pushed once started, so all queues being empty means the end.
+            while (this->pop(i, task_index) || this->steal(i, task_index))
+            {
+                func(task_index, i);
+            }
+        });
+    }
+
+    for (auto &t : threads)
+    {
+        t.join();
+    }
+}
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -0,0 +1,83 @@
+/*
+ * A fork-join thread pool with work stealing.
+ *
+ * Copyright (c) 2026 agent <agent@local>
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __WORK_POOL_HPP__
+#define __WORK_POOL_HPP__
+
+#include <stddef.h>
+
+#include <deque>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <functional>
+
+/*
+ * Tasks are dealt to per-worker queues in contiguous chunks at first.
+ * A worker takes tasks from the back of its own queue, and steals from the front
+ * of others' once its own runs dry, so that a few heavy tasks don't stall the rest.
+ */
+class WorkStealingPool
+{
+private:
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool &) = delete;
+
+public:
+    typedef std::function<void(size_t task_index, int worker_index)> task_func_t;
+
+    WorkStealingPool() = delete;
+
+    explicit WorkStealingPool(int worker_count);
+
+public:
+    inline int worker_count(void) const
+    {
+        return m_worker_count;
+    }
+
+    // Runs func on each task index within [0, task_count), and returns after all done.
+    void run(size_t task_count, const task_func_t &func);
+
+private:
+    bool pop(int worker_index, size_t &task_index);
+
+    bool steal(int thief_index, size_t &task_index);
+
+private:
+    struct TaskQueue
+    {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    int m_worker_count;
+    std::vector<std::unique_ptr<TaskQueue>> m_queues;
+};
+
+#endif /* #ifndef __WORK_POOL_HPP__ */
+
+/*
+ * ================
+ *   CHANGE LOG
+ * ================
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Initial commit.
+ */
+
@@ -15,10 +15,12 @@
 */
 
 #include <string.h>
+#include <errno.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <getopt.h>
 #include <assert.h>
+#include <signal.h>
 
 #include "versions.h"
 
@@ -26,11 +28,22 @@
 #include <vector>
 #include <map>
 #include <iostream>
+#include <algorithm>
+#include <thread>
 #include <QApplication>
 #include <QDialog>
+#include <QDir>
+#include <QFileInfo>
 
 #include "qt_print.hpp"
 #include "regpanel.hpp"
+#include "reg_encoder.hpp"
+#include "reg_server.hpp"
+#include "reg_batch.hpp"
+#include "reg_stats.hpp"
+#include "reg_codegen.hpp"
+#include "reg_archive.hpp"
+#include "reg_lint.hpp"
 
 // Must be coincident with the copyright info at the beginning of this file.
 #ifndef COPYRIGHT_STRING
@@ -46,9 +59,31 @@
 #define USAGE_FORMAT                    "[OPTION...] [FILE...]"
 #endif
 
-#define BIZ_TYPE_CANDIDATES             "normal,test"
+#define BIZ_TYPE_CANDIDATES             "normal,test,encode,server,batch,stats,header,regmap,pack,lint"
 #define BIZ_TYPE_DEFAULT                "normal"
 
+#define DELIMITER_CANDIDATES            "curly,square"
+#define DELIMITER_DEFAULT               "curly"
+
+#define ADDR_BASE_METHOD_CANDIDATES     "ignore,add,subtract,global"
+#define ADDR_BASE_METHOD_DEFAULT        "ignore"
+
+#define OUTPUT_FORMAT_CANDIDATES        "csv,bin"
+#define OUTPUT_FORMAT_DEFAULT           "csv"
+
+#ifndef DEFAULT_SOCKET_PATH
+#define DEFAULT_SOCKET_PATH             "/tmp/regpanel.sock"
+#endif
+
+#define MAX_WORKER_COUNT                256
+
+#define PREFETCH_CAP_DEFAULT            64 // MiB
+#define MAX_PREFETCH_CAP                4096 // MiB
+
+#ifndef DEFAULT_SESSION_FILE
+#define DEFAULT_SESSION_FILE            "~/.regpanel.session"
+#endif
+
 #ifndef DEFAULT_CONF_DIR
 #define DEFAULT_CONF_DIR                "/usr/local/etc/regpanel"
 #endif
@@ -81,6 +116,19 @@ typedef struct cmd_args
     std::string biz;
     std::string config_dir;
     std::string config_file;
+    std::string reg_file;
+    std::string module;
+    std::string output;
+    std::string format;
+    std::string delimiter;
+    std::string addr_base_method;
+    std::string addr_base;
+    std::string socket_path;
+    int workers;
+    bool all_fields;
+    std::string annotations;
+    std::string session;
+    int prefetch_cap; // MiB
 #ifdef HAS_LOGGER
     std::string log_file;
     std::string log_level;
@@ -136,7 +184,8 @@ cmd_args_t parse_cmdline(int argc, char **argv)
 #endif
         {
             { "config-dir", required_argument, nullptr, 'C' },
-            " /PATH/TO/CONFIG/DIR\n\t\t\tSpecify configuration directory. Default to " DEFAULT_CONF_DIR "."
+            " /PATH/TO/CONFIG/DIR\n\t\t\tSpecify configuration directory, or an archive made by pack biz in place of it."
+                " Default to " DEFAULT_CONF_DIR "."
         },
 #ifdef HAS_CONFIG_FILE
         {
@@ -148,6 +197,68 @@ cmd_args_t parse_cmdline(int argc, char **argv)
             { "biz", required_argument, nullptr, 'b' },
             " {" BIZ_TYPE_CANDIDATES "}\n\t\t\tSpecify biz type. Default to " BIZ_TYPE_DEFAULT "."
         },
+        {
+            { "reg-file", required_argument, nullptr, 'f' },
+            " VENDOR/CHIP/FILE\n\t\t\tSpecify register configuration file for headless biz types,"
+                " relative to configuration directory unless it's an absolute path."
+        },
+        {
+            { "module", required_argument, nullptr, 'm' },
+            " MODULE\n\t\t\tSpecify module for headless decoding and header generation."
+                " All modules with __base__ are looked up by absolute addresses,"
+                " or all modules are generated, if not specified."
+        },
+        {
+            { "output", required_argument, nullptr, 'o' },
+            " /PATH/TO/OUTPUT/FILE\n\t\t\tSpecify output file of headless biz types. Default to stdout."
+        },
+        {
+            { "format", required_argument, nullptr, 0 },
+            " {" OUTPUT_FORMAT_CANDIDATES "}\n\t\t\tSpecify output format of batch biz. Default to "
+                OUTPUT_FORMAT_DEFAULT "."
+        },
+        {
+            { "delimiter", required_argument, nullptr, 0 },
+            " {" DELIMITER_CANDIDATES "}\n\t\t\tSpecify delimiter of register array items. Default to "
+                DELIMITER_DEFAULT "."
+        },
+        {
+            { "addr-base-method", required_argument, nullptr, 0 },
+            " {" ADDR_BASE_METHOD_CANDIDATES "}\n\t\t\tSpecify address base method. Default to "
+                ADDR_BASE_METHOD_DEFAULT "."
+        },
+        {
+            { "addr-base", required_argument, nullptr, 0 },
+            " HEX\n\t\t\tSpecify address base for add and subtract methods. Default to 0."
+        },
+        {
+            { "socket", required_argument, nullptr, 0 },
+            " /PATH/TO/SOCKET\n\t\t\tSpecify Unix domain socket of server biz. Default to " DEFAULT_SOCKET_PATH "."
+        },
+        {
+            { "workers", required_argument, nullptr, 0 },
+            " NUM\n\t\t\tSpecify number of worker threads of server, batch, stats and lint biz."
+                " Default to 0 (number of CPU cores)."
+        },
+        {
+            { "all-fields", no_argument, nullptr, 0 },
+            "\tList all fields rather than flagged ones only in report of stats biz."
+        },
+        {
+            { "annotations", required_argument, nullptr, 0 },
+            " /PATH/TO/REPORT\n\t\t\tSpecify a report of stats biz to annotate fields of normal biz with."
+        },
+        {
+            { "session", required_argument, nullptr, 0 },
+            " /PATH/TO/SESSION\n\t\t\tSpecify session snapshot of normal biz, which is restored on start"
+                " and saved periodically and on exit. Default to " DEFAULT_SESSION_FILE
+                ", and an empty string disables it."
+        },
+        {
+            { "prefetch-cap", required_argument, nullptr, 0 },
+            " MIB\n\t\t\tSpecify memory cap of prefetching other files of the selected chip and pre-building"
+                " register tables in normal biz. Default to 64, and 0 disables it."
+        },
     };
     struct option long_options[sizeof(OPTION_RULES) / sizeof(OPTION_RULES[0]) + 1];
     std::map<std::string, char> abbr_map;
@@ -183,6 +294,13 @@ cmd_args_t parse_cmdline(int argc, char **argv)
      */
     result.biz = BIZ_TYPE_DEFAULT;
     result.config_dir = DEFAULT_CONF_DIR;
+    result.format = OUTPUT_FORMAT_DEFAULT;
+    result.delimiter = DELIMITER_DEFAULT;
+    result.addr_base_method = ADDR_BASE_METHOD_DEFAULT;
+    result.addr_base = "0";
+    result.socket_path = DEFAULT_SOCKET_PATH;
+    result.session = DEFAULT_SESSION_FILE;
+    result.prefetch_cap = PREFETCH_CAP_DEFAULT;
 #ifdef HAS_CONFIG_FILE
     result.config_file = DEFAULT_CONF_FILE;
 #endif
@@ -219,6 +337,26 @@ cmd_args_t parse_cmdline(int argc, char **argv)
                 printf("%s\n", __VER__);
                 exit(EXIT_SUCCESS);
             }
+            else if (0 == strcmp(long_opt, "format"))
+                result.format = optarg;
+            else if (0 == strcmp(long_opt, "delimiter"))
+                result.delimiter = optarg;
+            else if (0 == strcmp(long_opt, "addr-base-method"))
+                result.addr_base_method = optarg;
+            else if (0 == strcmp(long_opt, "addr-base"))
+                result.addr_base = optarg;
+            else if (0 == strcmp(long_opt, "socket"))
+                result.socket_path = optarg;
+            else if (0 == strcmp(long_opt, "workers"))
+                result.workers = atoi(optarg);
+            else if (0 == strcmp(long_opt, "all-fields"))
+                result.all_fields = true;
+            else if (0 == strcmp(long_opt, "annotations"))
+                result.annotations = optarg;
+            else if (0 == strcmp(long_opt, "session"))
+                result.session = optarg;
+            else if (0 == strcmp(long_opt, "prefetch-cap"))
+                result.prefetch_cap = atoi(optarg);
 #ifdef HAS_LOGGER
             else if (0 == strcmp(long_opt, "logfile"))
                 result.log_file = optarg;
@@ -238,6 +376,12 @@ cmd_args_t parse_cmdline(int argc, char **argv)
             result.biz = optarg;
         else if (abbr_map["config-dir"] == c)
             result.config_dir = optarg;
+        else if (abbr_map["reg-file"] == c)
+            result.reg_file = optarg;
+        else if (abbr_map["module"] == c)
+            result.module = optarg;
+        else if (abbr_map["output"] == c)
+            result.output = optarg;
 #ifdef HAS_CONFIG_FILE
         else if (abbr_map["config"] == c)
             result.config_file = optarg;
@@ -320,6 +464,9 @@ void assert_parsed_args(const cmd_args_t &args)
         const char *candidates;
     } enum_str_args[] = {
         { "biz type", args.biz.c_str(), BIZ_TYPE_CANDIDATES },
+        { "output format", args.format.c_str(), OUTPUT_FORMAT_CANDIDATES },
+        { "delimiter", args.delimiter.c_str(), DELIMITER_CANDIDATES },
+        { "address base method", args.addr_base_method.c_str(), ADDR_BASE_METHOD_CANDIDATES },
 #ifdef HAS_LOGGER
         { "log level", args.log_level.c_str(), LOG_LEVEL_CANDIDATES },
 #endif
@@ -345,6 +492,31 @@ void assert_parsed_args(const cmd_args_t &args)
             exit(EINVAL);
         }
     }
+
+    char *end_ptr;
+
+    strtoull(args.addr_base.c_str(), &end_ptr, 16);
+    if (args.addr_base.empty() || '\0' != *end_ptr)
+    {
+        fprintf(stderr, "*** Invalid address base: %s\n", args.addr_base.c_str());
+        exit(EINVAL);
+    }
+
+    assert_comparable_arg("worker count", args.workers, 0, MAX_WORKER_COUNT);
+    assert_comparable_arg("prefetch cap", args.prefetch_cap, 0, MAX_PREFETCH_CAP);
+
+    if (("encode" == args.biz || "batch" == args.biz || "stats" == args.biz || "header" == args.biz
+        || "regmap" == args.biz) && args.reg_file.empty())
+    {
+        fprintf(stderr, "*** Register configuration file must be specified for biz[%s]!\n", args.biz.c_str());
+        exit(EINVAL);
+    }
+
+    if ("pack" == args.biz && args.output.empty())
+    {
+        fprintf(stderr, "*** Output file must be specified for biz[%s]!\n", args.biz.c_str());
+        exit(EINVAL);
+    }
 } // void assert_parsed_args(const cmd_args_t &args)
 
 #define todo()                          fprintf(stderr, __FILE__ ":%d %s(): todo ...\n", __LINE__, __func__)
@@ -407,6 +579,22 @@ static DECLARE_BIZ_FUN(normal_biz)
 
     QT_SET_THREAD_NAME("MAIN");
 
+    panel.set_prefetch_cap(static_cast<size_t>(parsed_args.prefetch_cap) << 20);
+
+    if (!parsed_args.annotations.empty())
+        panel.load_field_annotations(QString::fromStdString(parsed_args.annotations));
+
+    if (!parsed_args.session.empty())
+    {
+        QString session_path = QString::fromStdString(parsed_args.session);
+
+        if (session_path.startsWith("~/"))
+            session_path.replace(0, 1, QDir::homePath());
+
+        panel.restore_session(session_path); // after annotations, which are applied on making tables
+        panel.enable_session_autosave(session_path);
+    }
+
     panel.show();
 
     return app.exec();
@@ -419,6 +607,368 @@ static DECLARE_BIZ_FUN(test_biz)
     return EXIT_SUCCESS;
 }
 
+static QString reg_file_path(const cmd_args_t &args)
+{
+    if ('/' == args.reg_file[0])
+        return QString::fromStdString(args.reg_file);
+
+    return QString::fromStdString(args.config_dir + "/" + args.reg_file);
+}
+
+static int write_output(const cmd_args_t &args, const QString &text)
+{
+    FILE *fp = args.output.empty() ? stdout : fopen(args.output.c_str(), "w");
+    const QByteArray &bytes = text.toUtf8();
+    int err = 0;
+
+    if (nullptr == fp)
+    {
+        err = errno;
+        fprintf(stderr, "*** Failed to open %s: %s\n", args.output.c_str(), strerror(err));
+
+        return err;
+    }
+
+    if (fwrite(bytes.constData(), 1, bytes.size(), fp) != static_cast<size_t>(bytes.size()))
+        err = errno ? errno : EIO;
+
+    if (stdout != fp)
+        fclose(fp);
+    else
+        fflush(fp);
+
+    return err;
+}
+
+/*
+ * Assignment files are given as orphan arguments, "-" or none for stdin.
+ * See reg_encoder.hpp for the statement syntax.
+ */
+static DECLARE_BIZ_FUN(encode_biz)
+{
+    const QString &path = reg_file_path(parsed_args);
+    RegConfig config;
+    QString err_msg;
+    int ret = load_reg_config(path, config, &err_msg);
+
+    if (ret < 0)
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return -ret;
+    }
+
+    RegEncoder encoder(config);
+    std::vector<std::string> inputs(parsed_args.orphan_args);
+    int fail_count = 0;
+
+    if (inputs.empty())
+        inputs.push_back("-");
+
+    for (const auto &input : inputs)
+    {
+        if ((ret = encoder.load(QString::fromStdString(input))) < 0)
+            return -ret;
+
+        fail_count += ret;
+    }
+
+    if (fail_count > 0)
+    {
+        fprintf(stderr, "*** %d statement(s) failed, nothing generated.\n", fail_count);
+
+        return EINVAL;
+    }
+
+    int delim_index = (parsed_args.delimiter == "square") ? SQUARE_BRACKETS : CURLY_BRACES;
+    AddrBaseMethod method = parse_addr_base_method(QString::fromStdString(parsed_args.addr_base_method));
+    uint64_t addr_base = strtoull(parsed_args.addr_base.c_str(), nullptr, 16);
+
+    return write_output(parsed_args, encoder.generate(delim_index, method, addr_base));
+}
+
+/*
+ * Dump files or directories containing them are given as orphan arguments.
+ * See reg_batch.hpp for the output formats.
+ */
+static DECLARE_BIZ_FUN(batch_biz)
+{
+    const QString &path = reg_file_path(parsed_args);
+    RegConfig config;
+    QString err_msg;
+    int ret = load_reg_config(path, config, &err_msg);
+
+    if (ret < 0)
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return -ret;
+    }
+
+    std::vector<std::string> dump_files;
+
+    RegBatchDecoder::collect_files(parsed_args.orphan_args, dump_files);
+    if (dump_files.empty())
+    {
+        fprintf(stderr, "*** No dump files specified!\n");
+
+        return EINVAL;
+    }
+
+    FILE *fp = parsed_args.output.empty() ? stdout : fopen(parsed_args.output.c_str(), "wb");
+
+    if (nullptr == fp)
+    {
+        ret = errno;
+        fprintf(stderr, "*** Failed to open %s: %s\n", parsed_args.output.c_str(), strerror(ret));
+
+        return ret;
+    }
+
+    int delim_index = (parsed_args.delimiter == "square") ? SQUARE_BRACKETS : CURLY_BRACES;
+    AddrBaseMethod method = parse_addr_base_method(QString::fromStdString(parsed_args.addr_base_method));
+    uint64_t addr_base = strtoull(parsed_args.addr_base.c_str(), nullptr, 16);
+    int workers = (parsed_args.workers > 0) ? parsed_args.workers
+        : std::max(1U, std::thread::hardware_concurrency());
+    RegBatchDecoder batch(config, QString::fromStdString(parsed_args.module), delim_index, method, addr_base);
+
+    ret = batch.run(dump_files, fp, ("bin" == parsed_args.format) ? RegBatchDecoder::BINARY : RegBatchDecoder::CSV,
+        workers);
+
+    if (stdout != fp)
+        fclose(fp);
+
+    if (ret > 0)
+        fprintf(stderr, "*** %d of %lu dump(s) failed.\n", ret, dump_files.size());
+
+    return (ret > 0) ? EINVAL : -ret;
+}
+
+/*
+ * Dump files or directories containing them are given as orphan arguments.
+ * See reg_stats.hpp for the report format.
+ */
+static DECLARE_BIZ_FUN(stats_biz)
+{
+    const QString &path = reg_file_path(parsed_args);
+    RegConfig config;
+    QString err_msg;
+    int ret = load_reg_config(path, config, &err_msg);
+
+    if (ret < 0)
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return -ret;
+    }
+
+    std::vector<std::string> dump_files;
+
+    RegBatchDecoder::collect_files(parsed_args.orphan_args, dump_files);
+    if (dump_files.empty())
+    {
+        fprintf(stderr, "*** No dump files specified!\n");
+
+        return EINVAL;
+    }
+
+    int delim_index = (parsed_args.delimiter == "square") ? SQUARE_BRACKETS : CURLY_BRACES;
+    AddrBaseMethod method = parse_addr_base_method(QString::fromStdString(parsed_args.addr_base_method));
+    uint64_t addr_base = strtoull(parsed_args.addr_base.c_str(), nullptr, 16);
+    int workers = (parsed_args.workers > 0) ? parsed_args.workers
+        : std::max(1U, std::thread::hardware_concurrency());
+    RegFieldStats stats(config, QString::fromStdString(parsed_args.module), delim_index, method, addr_base);
+
+    if ((ret = stats.run(dump_files, workers)) < 0)
+        return -ret;
+
+    if (ret > 0)
+        fprintf(stderr, "*** %d of %lu dump(s) failed, excluded from the report.\n", ret, dump_files.size());
+
+    const QJsonDocument report(stats.report(parsed_args.all_fields));
+
+    return write_output(parsed_args, QString::fromUtf8(report.toJson()));
+}
+
+/*
+ * See reg_codegen.hpp for the contents of header.
+ */
+static DECLARE_BIZ_FUN(header_biz)
+{
+    const QString &path = reg_file_path(parsed_args);
+    RegConfig config;
+    QString err_msg;
+    int ret = load_reg_config(path, config, &err_msg);
+
+    if (ret < 0)
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return -ret;
+    }
+
+    const QString &header = generate_cpp_header(config, QString::fromStdString(parsed_args.module), &err_msg);
+
+    if (header.isEmpty())
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return ENOENT;
+    }
+
+    return write_output(parsed_args, header);
+}
+
+/*
+ * Assignment files for the init tables are given as orphan arguments, optional.
+ * See reg_codegen.hpp for the tables generated.
+ */
+static DECLARE_BIZ_FUN(regmap_biz)
+{
+    const QString &path = reg_file_path(parsed_args);
+    RegConfig config;
+    QString err_msg;
+    int ret = load_reg_config(path, config, &err_msg);
+
+    if (ret < 0)
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return -ret;
+    }
+
+    RegEncoder encoder(config);
+    int fail_count = 0;
+
+    for (const auto &input : parsed_args.orphan_args)
+    {
+        if ((ret = encoder.load(QString::fromStdString(input))) < 0)
+            return -ret;
+
+        fail_count += ret;
+    }
+
+    if (fail_count > 0)
+    {
+        fprintf(stderr, "*** %d statement(s) failed, nothing generated.\n", fail_count);
+
+        return EINVAL;
+    }
+
+    AddrBaseMethod method = parse_addr_base_method(QString::fromStdString(parsed_args.addr_base_method));
+    uint64_t addr_base = strtoull(parsed_args.addr_base.c_str(), nullptr, 16);
+    const QString &tables = generate_regmap_tables(config, QString::fromStdString(parsed_args.module),
+        &encoder, method, addr_base, &err_msg);
+
+    if (tables.isEmpty())
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return ENOENT;
+    }
+
+    return write_output(parsed_args, tables);
+}
+
+/*
+ * Output file is required. See reg_archive.hpp for the archive format.
+ */
+static DECLARE_BIZ_FUN(pack_biz)
+{
+    QString err_msg;
+    int count = RegConfigArchive::pack(QString::fromStdString(parsed_args.config_dir),
+        QString::fromStdString(parsed_args.output), &err_msg);
+
+    if (count < 0)
+    {
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+        return -count;
+    }
+
+    printf("%d configuration file(s) packed into %s\n", count, parsed_args.output.c_str());
+
+    return 0;
+}
+
+/*
+ * Configuration files are given as orphan arguments in the form of VENDOR/CHIP/FILE like --reg-file,
+ * or all files of the configuration directory are checked if none. See reg_lint.hpp for the report format.
+ */
+static DECLARE_BIZ_FUN(lint_biz)
+{
+    const QString &config_dir = QString::fromStdString(parsed_args.config_dir);
+    std::vector<QString> paths;
+
+    for (const auto &arg : parsed_args.orphan_args)
+    {
+        paths.push_back(QString::fromStdString(arg));
+    }
+
+    if (paths.empty() && RegConfigLinter::collect_files(config_dir, paths) < 0)
+    {
+        fprintf(stderr, "*** Non-existent or unreadable directory: %s\n", parsed_args.config_dir.c_str());
+
+        return ENOENT;
+    }
+
+    int workers = (parsed_args.workers > 0) ? parsed_args.workers
+        : std::max(1U, std::thread::hardware_concurrency());
+    RegConfigLinter linter(config_dir);
+    int fail_count = linter.run(paths, workers);
+    const QJsonDocument report(linter.report());
+    int ret = write_output(parsed_args, QString::fromUtf8(report.toJson()));
+
+    if (ret)
+        return ret;
+
+    if (fail_count > 0)
+    {
+        fprintf(stderr, "*** %lu issue(s) found in %d of %lu file(s).\n", linter.issue_count(), fail_count,
+            paths.size());
+    }
+
+    return (fail_count > 0) ? EINVAL : 0;
+}
+
+// An archive specified via --config-dir is mounted in place of the directory for all biz types but pack.
+static int mount_config_archive_if_any(const cmd_args_t &args)
+{
+    const QString &path = QString::fromStdString(args.config_dir);
+    QString err_msg;
+    int ret;
+
+    if ("pack" == args.biz || !QFileInfo(path).isFile())
+        return 0;
+
+    if ((ret = mount_reg_archive(path, &err_msg)) < 0)
+        fprintf(stderr, "*** %s\n", err_msg.toStdString().c_str());
+
+    return ret;
+}
+
+static void on_stop_signal(int signum)
+{
+    RegServer::stop();
+}
+
+/*
+ * See reg_server.hpp for the protocol.
+ */
+static DECLARE_BIZ_FUN(server_biz)
+{
+    int workers = (parsed_args.workers > 0) ? parsed_args.workers
+        : std::max(1U, std::thread::hardware_concurrency());
+    RegServer server(parsed_args.config_dir, parsed_args.socket_path, workers);
+
+    QT_SET_THREAD_NAME("MAIN");
+
+    signal(SIGINT, on_stop_signal);
+    signal(SIGTERM, on_stop_signal);
+
+    return server.run();
+}
+
 int main(int argc, char **argv)
 {
     cmd_args_t parsed_args = parse_cmdline(argc, argv);
@@ -426,6 +976,14 @@ int main(int argc, char **argv)
     std::map<std::string, biz_func_t> biz_handlers = {
         { "normal", BIZ_FUN(normal_biz) },
         { "test", BIZ_FUN(test_biz) },
+        { "encode", BIZ_FUN(encode_biz) },
+        { "server", BIZ_FUN(server_biz) },
+        { "batch", BIZ_FUN(batch_biz) },
+        { "stats", BIZ_FUN(stats_biz) },
+        { "header", BIZ_FUN(header_biz) },
+        { "regmap", BIZ_FUN(regmap_biz) },
+        { "pack", BIZ_FUN(pack_biz) },
+        { "lint", BIZ_FUN(lint_biz) },
     };
     biz_func_t biz_func = nullptr;
     int ret;
@@ -447,6 +1005,9 @@ int main(int argc, char **argv)
     if ((ret = register_signals(parsed_args, conf)) < 0)
         goto lbl_finalize_log;
 
+    if ((ret = mount_config_archive_if_any(parsed_args)) < 0)
+        goto lbl_finalize_log;
+
     ret = biz_func(argc, argv, parsed_args, conf);
 
 lbl_finalize_log:
@@ -474,5 +1035,26 @@ lbl_unload_conf:
  *
  * >>> 2025-04-08, Man Hung-Coeng <udc577@126.com>:
  *  01. Remove module prefix of each Qt header files to improve robustness.
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Add biz type "encode" to generate register arrays from field assignments
+ *      without GUI, along with options --reg-file, --output, --delimiter,
+ *      --addr-base-method and --addr-base.
+ *  02. Add biz type "server" to serve decoding, encoding and diff requests
+ *      over a Unix domain socket, along with options --socket and --workers.
+ *  03. Add biz type "batch" to decode lots of dumps in parallel into CSV or
+ *      binary columnar output, along with options --module and --format.
+ *  04. Add biz type "stats" to report field value histograms and anomalies
+ *      across dumps, along with options --all-fields and --annotations.
+ *  05. Add biz type "header" to generate C++ headers of constexpr addresses
+ *      and field accessors.
+ *  06. Add biz type "regmap" to generate init sequences and access tables
+ *      for Linux kernel drivers using regmap.
+ *  07. Add option --session to restore and autosave sessions of normal biz.
+ *  08. Add option --prefetch-cap to cap memory of prefetching in normal biz.
+ *  09. Add biz type "pack" to pack the configuration directory into a single archive,
+ *      which is mounted if specified via --config-dir in place of the directory.
+ *  10. Add biz type "lint" to check configuration files in parallel, with a JSON report
+ *      and a non-zero exit code on any issue.
  */
 
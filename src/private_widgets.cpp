@@ -18,14 +18,18 @@
 
 #include "private_widgets.hpp"
 
-#include <set>
+#include <unordered_map>
 
 #include <QComboBox>
+#include <QStringListModel>
+#include <QApplication>
 #include <QHeaderView>
+#include <QStyle>
 #include <QJsonObject>
 #include <QJsonArray>
 
 #include "qt_print.hpp"
+#include "reg_schema.hpp"
 
 int resize_table_height(QTableWidget *table, bool header_row_visible)
 {
@@ -59,6 +63,55 @@ int resize_table_height(QTableWidget *table, bool header_row_visible)
     return table_height;
 }
 
+const char* reg_tables_style_sheet(void)
+{
+    return "QAbstractSpinBox[access=\"ro\"], QTextEdit[access=\"ro\"] { background-color: darkgray; color: white; }"
+        "QAbstractSpinBox[access=\"rw\"], QTextEdit[access=\"rw\"] {"
+            " background-color: " SOFT_GREEN_COLOR "; color: black; }"
+        "QLineEdit[role=\"title\"] { background: transparent; border: none; color: orange; }"
+        "QLineEdit[role=\"title\"][flagged=\"true\"] { color: red; }"
+        "QLineEdit[role=\"desc_title\"] { background: transparent; border: none; }"
+        "QLineEdit[role=\"desc_title\"][hinted=\"true\"] { color: blue; }"
+        "QLabel[flagged=\"true\"] { color: red; font-weight: bold; }";
+}
+
+void set_style_property(QWidget *widget, const char *name, const QVariant &value)
+{
+    if (widget->property(name) == value)
+        return;
+
+    widget->setProperty(name, value);
+    // Property selectors are matched on polishing, which has not happened yet to a widget under construction.
+    if (widget->testAttribute(Qt::WA_WState_Polished))
+    {
+        widget->style()->unpolish(widget);
+        widget->style()->polish(widget);
+    }
+}
+
+const QFont& register_title_font(void)
+{
+    static QFont s_font;
+
+    if (!s_font.bold())
+    {
+        s_font.setBold(true);
+        s_font.setPointSize(22);
+    }
+
+    return s_font;
+}
+
+const QFont& hinted_title_font(void)
+{
+    static QFont s_font;
+
+    if (!s_font.underline())
+        s_font.setUnderline(true);
+
+    return s_font;
+}
+
 /******************************** BigSpinBox begin ********************************/
 
 QValidator::State BigSpinBox::validate(QString &input, int &pos) const/* override */
@@ -85,37 +138,21 @@ QValidator::State BigSpinBox::validate(QString &input, int &pos) const/* overrid
 }
 
 /*
- * NOTE 1: This reimplemented function affects the initial default and current values
- *      of each RegFullValuesRow item. Without this function,
- *      a value greater than INT32_MAX (0x7fffffff) will become 0,
- *      but the reason is uncertain yet.
- *
- * NOTE 2: Meanwhile, it causes a new bug that the displaying text of combo box fails to get updated
- *      when the user clicks the Up/Down buttons or presses the keyboard Up/Down arrows instead of
- *      inputting the expected value directly.
- *      To solve this bug, I have to reimplement one more function stepBy() after this one.
+ * NOTE: QSpinBox keeps only a truncated int value, and calls this function to refresh the text
+ *      on its own from time to time (e.g.: on range changes and focus-out), so the value stored in
+ *      m_value64 is always formatted here regardless of the argument.
  */
 QString BigSpinBox::textFromValue(int val/* This value is truncated and thus not used. */) const/* override */
 {
-    const QString &text = this->lineEdit()->displayText();
-    int base = this->displayIntegerBase();
-    uint64_t value = text.toULongLong(nullptr, base); // Converted from instant text instead of using the old m_value64.
-
-    qtCDebugV(::, "%s: base = %d, m_value64 = 0x%lx, text = %s, result = 0x%lx",
-        this->name().c_str(), base, m_value64, text.toStdString().c_str(), value);
-
-    return QString::number(value, base);
+    return QString::number(m_value64, this->displayIntegerBase());
 }
 
-/*
- * NOTE: This reimplemented function is for fixing a bug caused by textFromValue() above.
- */
 void BigSpinBox::stepBy(int steps)/* override */
 {
     if (0 == steps)
         return;
 
-    uint64_t val = this->lineEdit()->displayText().toULongLong(nullptr, this->displayIntegerBase()); // this->value()
+    uint64_t val = m_value64;
     uint64_t min = this->minimum();
     uint64_t max = this->maximum();
 
@@ -132,18 +169,34 @@ void BigSpinBox::stepBy(int steps)/* override */
 
 void BigSpinBox::setValue(uint64_t val)
 {
-    if (/*val == m_value64 || */val < m_minimum64 || val > m_maximum64)
+    if (val == m_value64 || val < m_minimum64 || val > m_maximum64)
         return;
 
-    QString text = this->prefix() + QString::number(val, this->displayIntegerBase());
+    m_value64 = val;
+    this->lineEdit()->setText(this->prefix() + this->textFromValue(0)); // the only place of formatting
+    qtCDebugV(::, "%s: val = 0x%lx", this->name().c_str(), val);
+
+    emit this->valueChanged(val);
+}
+
+// Otherwise, value() changes only via setValue(), e.g.: a typed address base would be read as 0.
+void BigSpinBox::on_lineedit_textEdited(const QString &text)
+{
+    QString digits = text.trimmed();
+    bool ok = false;
+
+    if (digits.startsWith("0x"))
+        digits.remove(0, 2);
+
+    uint64_t val = digits.toULongLong(&ok, this->displayIntegerBase());
+
+    // Intermediate input like an empty string is ignored until it's complete.
+    if (!ok || val < m_minimum64 || val > m_maximum64 || val == m_value64)
+        return;
 
     m_value64 = val;
-    this->lineEdit()->setText(text);
-    qtCDebugV(::, "%s: val = 0x%lx, text = %s, displayText() = %s",
-        this->name().c_str(), val, text.toStdString().c_str(), this->lineEdit()->displayText().toStdString().c_str());
 
-    //emit this->valueChanged(val);
-    emit this->textChanged(this->lineEdit()->displayText());
+    emit this->valueChanged(val);
 }
 
 /******************************** BigSpinBox end ********************************/
@@ -163,14 +216,14 @@ RegFullValuesRow::RegFullValuesRow(QWidget *parent, const QString &name_prefix,
     m_def_value.setRange(0, UINT64_MAX);
     m_def_value.setValue(default_value);
     m_def_value.setReadOnly(true);
+    m_def_value.setProperty("access", "ro");
 
     m_curr_label.setObjectName(name_prefix + "_full_values_curr_label");
     m_curr_value.setObjectName(name_prefix + "_full_values_curr_val");
     m_curr_value.setRange(0, UINT64_MAX);
     m_curr_value.setValue(current_value);
-    m_curr_value.setReadOnly(true);
-    if (!m_curr_value.isReadOnly())
-        m_curr_value.setStyleSheet("background-color: " SOFT_GREEN_COLOR "; color: black;");
+    m_curr_value.setReadOnly(false); // a full value can be typed or pasted as a whole
+    m_curr_value.setProperty("access", m_curr_value.isReadOnly() ? "ro" : "rw");
 
     this->setObjectName(name_prefix + "_full_values");
     this->setShowGrid(false);
@@ -195,90 +248,67 @@ RegFullValuesRow::~RegFullValuesRow()
 
 /******************************** RegBitsDescCell begin ********************************/
 
+// Built once per distinct enum definition and shared by all pull-down lists, never modified afterwards.
+static QStringListModel* shared_enum_model(const RegEnum *enum_def)
+{
+    static std::unordered_map<const RegEnum *, QStringListModel *> s_models;
+    auto iter = s_models.find(enum_def);
+
+    if (s_models.end() != iter)
+        return iter->second;
+
+    auto *model = new QStringListModel(enum_def->labels, qApp); // enum definitions live as long as the process
+
+    s_models.insert({ enum_def, model });
+
+    return model;
+}
+
 RegBitsDescCell::RegBitsDescCell(QWidget *parent, const QString &name_prefix, const QString &title, const QString &hint,
     uint64_t value, uint64_t value_max, BigSpinBox::ShowStyle style,
-    const QJsonObject *enum_dict, bool is_readonly)
+    const RegEnum *enum_def, bool is_readonly)
     : QTableWidget(2, 1, parent)
     , m_title(title, this)
     , m_digit(nullptr)
     , m_enum(nullptr)
-    , m_badvalue_index(INVALID_INDEX)
+    , m_enum_def(enum_def)
 {
-    QString title_style = QString::asprintf("QLineEdit{ background: transparent; border: none; %s }",
-        hint.isEmpty() ? "" : "color: blue;");
-
     m_title.setObjectName(name_prefix + "_desc_title");
+    m_title.setProperty("role", "desc_title");
     if (!hint.isEmpty())
     {
-        QFont font;
-
-        font.setUnderline(true);
-        m_title.setFont(font);
-        title_style += "QToolTip { color: white; }";
+        // NOTE: Tool tips don't inherit the blue color of title any more, and need no white one.
+        m_title.setProperty("hinted", true);
+        m_title.setFont(hinted_title_font());
         m_title.setToolTip(hint);
         m_title.setWhatsThis(hint);
     }
-    m_title.setStyleSheet(title_style);
     m_title.setReadOnly(true);
 
-    if (enum_dict)
+    if (enum_def)
     {
-        int index = 0;
-        std::vector<uint16_t> bad_indexes;
-        uint64_t bad_key = 0xffff;
-        std::set<uint64_t> key_digits;
-
         m_enum = new QComboBox(this);
         m_enum->setObjectName(name_prefix + "_desc_enum");
         //m_enum->setDisabled(is_readonly);
-        m_enum_values.reserve(enum_dict->size());
-        bad_indexes.reserve(enum_dict->size());
-        for (QJsonObject::const_iterator iter = enum_dict->begin(); enum_dict->end() != iter; ++iter)
-        {
-            const std::string &key_str = iter.key().toStdString();
-            char *ptr;
-            uint64_t key_digit = strtoull(key_str.c_str(), &ptr, 16);
-
-            if (0 == key_digit && key_str.c_str() == ptr)
-            {
-                m_badvalue_index = index++;
-                bad_indexes.push_back(m_badvalue_index);
-            }
-            else
-            {
-                key_digits.insert(key_digit);
-            }
-
-            m_enum_values.push_back(key_digit);
-
-            m_enum->addItem(iter.value().toString("Invalid"));
-        }
-        for (uint16_t i = 0; i < (uint16_t)0xffff; ++i)
-        {
-            if (key_digits.end() == key_digits.find(i))
-            {
-                bad_key = i;
-                break;
-            }
-        }
-        for (auto bad_index : bad_indexes)
-        {
-            m_enum_values[bad_index] = bad_key;
-        }
+        m_enum->setModel(shared_enum_model(enum_def));
 
         this->connect(m_enum, SIGNAL(currentIndexChanged(int)),
             this, SLOT(on_enumbox_currentIndexChanged(int)));
-    } // if (enum_dict)
+    } // if (enum_def)
     else
     {
         m_digit = new BigSpinBox(style, this);
         m_digit->setObjectName(name_prefix + "_desc_digit");
         //m_digit->setReadOnly(is_readonly);
         m_digit->setRange(0, value_max);
-        m_digit->setStyleSheet(is_readonly ? "background-color: darkgray; color: white;"
-            : "background-color: " SOFT_GREEN_COLOR "; color: black;");
+        m_digit->setProperty("access", is_readonly ? "ro" : "rw");
     }
     this->sync(value);
+    if (m_digit)
+    {
+        this->connect(m_digit, SIGNAL(valueChanged(uint64_t)),
+            this, SLOT(on_digitbox_valueChanged(uint64_t)));
+    }
 
     this->setObjectName(name_prefix + "_desc");
     this->setShowGrid(false);
@@ -286,7 +316,7 @@ RegBitsDescCell::RegBitsDescCell(QWidget *parent, const QString &name_prefix, co
     this->horizontalHeader()->setVisible(false);
     this->horizontalHeader()->setStretchLastSection(true); // Auto-stretch for the final columns
     this->setCellWidget(0, 0, &m_title);
-    if (enum_dict)
+    if (enum_def)
         this->setCellWidget(1, 0, m_enum);
     else
         this->setCellWidget(1, 0, m_digit);
@@ -297,8 +327,7 @@ RegBitsDescCell::RegBitsDescCell(RegBitsDescCell &&src)
     , m_title(src.m_title.text(), this)
     , m_digit(src.m_digit)
     , m_enum(src.m_enum)
-    , m_enum_values(std::move(src.m_enum_values))
-    , m_badvalue_index(src.m_badvalue_index)
+    , m_enum_def(src.m_enum_def)
 {
     src.setParent(nullptr);
     src.m_digit = nullptr;
@@ -329,206 +358,50 @@ void RegBitsDescCell::sync(uint64_t value)
 {
     if (m_digit)
     {
-        this->disconnect(m_digit, SIGNAL(textChanged(const QString &)),
-            this, SLOT(on_digitbox_textChanged(const QString &)));
+        const QSignalBlocker blocker(m_digit);
 
         m_digit->setValue(value);
-
-        this->connect(m_digit, SIGNAL(textChanged(const QString &)),
-            this, SLOT(on_digitbox_textChanged(const QString &)));
     }
     else
     {
-        for (size_t i = 0; i < m_enum_values.size(); ++i)
-        {
-            if (value == m_enum_values[i])
-            {
-                this->disconnect(m_enum, SIGNAL(currentIndexChanged(int)),
-                    this, SLOT(on_enumbox_currentIndexChanged(int)));
+        int index = m_enum_def->index_of(value); // falls back to "Others" if any
 
-                m_enum->setCurrentIndex(i);
+        if (index < 0 || index == m_enum->currentIndex())
+            return;
 
-                this->connect(m_enum, SIGNAL(currentIndexChanged(int)),
-                    this, SLOT(on_enumbox_currentIndexChanged(int)));
+        const QSignalBlocker blocker(m_enum);
 
-                return;
-            }
-        }
-
-        if (INVALID_INDEX != m_badvalue_index)
-        {
-            this->disconnect(m_enum, SIGNAL(currentIndexChanged(int)),
-                this, SLOT(on_enumbox_currentIndexChanged(int)));
-
-            m_enum->setCurrentIndex(m_badvalue_index);
-
-            this->connect(m_enum, SIGNAL(currentIndexChanged(int)),
-                this, SLOT(on_enumbox_currentIndexChanged(int)));
-        }
+        m_enum->setCurrentIndex(index);
     }
 }
 
-void RegBitsDescCell::on_digitbox_textChanged(const QString &text)
+void RegBitsDescCell::on_digitbox_valueChanged(uint64_t value)
 {
-    auto *bits_table = dynamic_cast<QTableWidget *>(this->parentWidget()->parentWidget());
-    int desc_column = bits_table->columnCount() - 1;
-    BigSpinBox *relevant_digit = nullptr;
-
-    for (int i = 0; i < bits_table->rowCount(); ++i)
-    {
-        if (bits_table->cellWidget(i, desc_column) == this)
-        {
-            relevant_digit = dynamic_cast<BigSpinBox *>(bits_table->cellWidget(i, 2));
-            break;
-        }
-    }
-
-    if (relevant_digit)
-        relevant_digit->setValue(strtoull(text.toStdString().c_str(), nullptr, text.startsWith("0x") ? 16 : 10));
+    emit this->valueChanged(value);
 }
 
 void RegBitsDescCell::on_enumbox_currentIndexChanged(int index)
 {
-    if (index < 0)
-        return;
-
-    auto *bits_table = dynamic_cast<QTableWidget *>(this->parentWidget()->parentWidget());
-    int desc_column = bits_table->columnCount() - 1;
-    BigSpinBox *relevant_digit = nullptr;
-
-    for (int i = 0; i < bits_table->rowCount(); ++i)
-    {
-        if (bits_table->cellWidget(i, desc_column) == this)
-        {
-            relevant_digit = dynamic_cast<BigSpinBox *>(bits_table->cellWidget(i, 2));
-            break;
-        }
-    }
-
-    if (relevant_digit)
-        relevant_digit->setValue(m_enum_values[index]);
+    if (index >= 0)
+        emit this->valueChanged(m_enum_def->values[index]);
 }
 
 /******************************** RegBitsDescCell end ********************************/
 
 /******************************** RegBitsTable begin ********************************/
 
-std::pair<int8_t, int8_t> check_bits_range(const char *range)
-{
-    std::pair<int8_t, int8_t> result = { -1, -1 };
-    char *end_ptr;
-
-    result.first = strtoul(range, &end_ptr, 10);
-
-    if ((0 == result.first && range == end_ptr) // No digits at all.
-        || result.first > 63)
-    {
-        result.first = -1;
-
-        return result;
-    }
-
-    if ('\0' != *range && '\0' == *end_ptr) // Entire string has been parsed.
-    {
-        result.second = result.first;
-
-        return result;
-    }
-
-    char *colon_ptr = (':' == *end_ptr) ? end_ptr : strchr(end_ptr, ':');
-
-    if (nullptr == colon_ptr || '\0' == colon_ptr[1]) // Only a single bit.
-    {
-        result.second = result.first;
-
-        return result;
-    }
-
-    result.second = atoi(colon_ptr + 1);
-
-    if (result.second < 0)
-    {
-        result.first = -1;
-
-        return result;
-    }
-
-    if (result.second > result.first)
-        result.first = result.second = -1;
-
-    return result;
-}
-
-enum BitsItemDesc
-{
-    BITS_ITEM_DESC_UNKNOWN,
-    BITS_ITEM_DESC_MISSING,
-    BITS_ITEM_DESC_TODO,
-    BITS_ITEM_DESC_RESERVED,
-    BITS_ITEM_DESC_ENUM,
-    BITS_ITEM_DESC_BOOL,
-    BITS_ITEM_DESC_INVBOOL, // inverse bool
-    BITS_ITEM_DESC_DECIMAL,
-    BITS_ITEM_DESC_UDECIMAL, // unsigned decimal
-    BITS_ITEM_DESC_HEX
-};
-
-static BitsItemDesc check_bits_item_desc_type(const char *desc)
-{
-    if (0 == strcasecmp(desc, "missing"))
-        return BITS_ITEM_DESC_MISSING;
-
-    if (0 == strcasecmp(desc, "TODO"))
-        return BITS_ITEM_DESC_TODO;
-
-    if (0 == strcasecmp(desc, "reserved"))
-        return BITS_ITEM_DESC_RESERVED;
-
-    if (0 == strcasecmp(desc, "enum"))
-        return BITS_ITEM_DESC_ENUM;
-
-    if (0 == strcasecmp(desc, "bool"))
-        return BITS_ITEM_DESC_BOOL;
-
-    if (0 == strcasecmp(desc, "invbool"))
-        return BITS_ITEM_DESC_INVBOOL;
-
-    if (0 == strcasecmp(desc, "decimal"))
-        return BITS_ITEM_DESC_DECIMAL;
-
-    if (0 == strcasecmp(desc, "udecimal"))
-        return BITS_ITEM_DESC_UDECIMAL;
-
-    if (0 == strcasecmp(desc, "hex"))
-        return BITS_ITEM_DESC_HEX;
-
-    return BITS_ITEM_DESC_UNKNOWN;
-}
-
-static inline uint64_t u64_lshift(uint64_t value, uint8_t shift)
-{
-    return (shift >= 64) ? 0 : (value << shift);
-}
-
-static inline uint64_t u64_rshift(uint64_t value, uint8_t shift)
-{
-    return (shift >= 64) ? 0 : (value >> shift);
-}
-
 RegBitsTable::RegBitsTable(QWidget *parent, const QString &name_prefix,
     const char *dict_key, const QJsonArray &dict_value,
     uint64_t default_value, uint64_t current_value)
-    : QTableWidget(dict_value.count(), 4, parent)
+    : QTableWidget(0, 4, parent)
+    , m_value(current_value)
+    , m_updating(false)
 {
     QStringList header_texts;
-    int value_size = dict_value.count();
-    auto gen_bits_mask = [](int8_t high, int8_t low) {
-        return ~u64_lshift(UINT64_MAX, high - low + 1);
-    };
-    auto extract_from_full_value = [&gen_bits_mask](uint64_t full_value, int8_t high, int8_t low) {
-        return (full_value >> low) & gen_bits_mask(high, low);
-    };
+    std::vector<RegField> &fields = this->m_fields;
+    int value_size = compile_reg_fields(dict_key, dict_value, fields);
 
+    this->setRowCount(value_size);
     this->setObjectName(name_prefix + "_bits");
     //this->setDragEnabled(false); // doesn't work
     this->setContentsMargins(0, 0, 0, 0);
@@ -540,151 +413,59 @@ RegBitsTable::RegBitsTable(QWidget *parent, const QString &name_prefix,
     this->m_desc_items.reserve(value_size);
     for (int i = 0; i < value_size; ++i)
     {
-        const QJsonValue &item = dict_value[i];
-
-        if (!item.isObject())
-        {
-            qtCErrV(::, "reg[%s]: item[%d] is not a dictionary/map!", dict_key, i);
-            continue;
-        }
-
-        const QJsonObject &dict = item.toObject();
-
-        if (!dict.contains("attr"))
-        {
-            qtCErrV(::, "reg[%s]: item[%d] does not contain an \"attr\" property!", dict_key, i);
-            continue;
-        }
-
-        const QJsonValue &attr_val = dict.value("attr");
-
-        if (!attr_val.isArray())
-        {
-            qtCErrV(::, "reg[%s]: item[%d]: Value of \"attr\" property is not an array!", dict_key, i);
-            continue;
-        }
-
-        const QJsonArray &attr_arr = attr_val.toArray();
-        int attr_size = attr_arr.count();
-
-        if (attr_size < 3)
-        {
-            qtCErrV(::, "reg[%s]: item[%d].attr: Too few elements, just %d!", dict_key, i, attr_size);
-            continue;
-        }
-
-        const std::string &bits_range = attr_arr[0].toString().toStdString();
-        auto range_pair = check_bits_range(bits_range.c_str());
-
-        if (range_pair.first < 0 || range_pair.second < 0)
-        {
-            qtCErrV(::, "reg[%s]: item[%d].attr: Invalid bits range: %s", dict_key, i, bits_range.c_str());
-            continue;
-        }
-
-        const std::string &desc_type_str = attr_arr[2].toString().toStdString();
-        auto desc_type = check_bits_item_desc_type(desc_type_str.c_str());
-
-        if (BITS_ITEM_DESC_UNKNOWN == desc_type)
-        {
-            qtCErrV(::, "reg[%s]: item[%d].attr[%s]: Invalid description type: %s",
-                dict_key, i, bits_range.c_str(), desc_type_str.c_str());
-            continue;
-        }
-        else if (BITS_ITEM_DESC_ENUM == desc_type)
-        {
-            if (!dict.contains("desc"))
-            {
-                qtCErrV(::, "reg[%s]: item[%d] does not contain an \"desc\" property!", dict_key, i);
-                continue;
-            }
-
-            const QJsonValue &desc_val = dict.value("desc");
-
-            if (!desc_val.isObject())
-            {
-                qtCErrV(::, "reg[%s]: item[%d]: Value of \"desc\" property is not a dictionary/map!", dict_key, i);
-                continue;
-            }
-
-            if (desc_val.toObject().count() <= 0)
-            {
-                qtCErrV(::, "reg[%s]: item[%d]: \"desc\" dictionary/map is empty!", dict_key, i);
-                continue;
-            }
-        }
-        else if (desc_type > BITS_ITEM_DESC_RESERVED && attr_size < 4)
-        {
-            qtCErrV(::, "reg[%s]: item[%d].attr[%s]: Missing title for description type[%s]",
-                dict_key, i, bits_range.c_str(), desc_type_str.c_str());
-            continue;
-        }
-        else
-        {
-            ; // nothing but for the sake of Code of Conduct
-        }
-
-        QString cell_name_prefix = name_prefix + QString::asprintf("_bits[%s]", bits_range.c_str());
-        uint64_t curr_value = extract_from_full_value(current_value, range_pair.first, range_pair.second);
-        uint64_t value_max = gen_bits_mask(range_pair.first, range_pair.second);
-        bool is_readonly = (0 == attr_arr[1].toString().compare("RO", Qt::CaseInsensitive));
-
-        this->m_ranges.push_back(new QLabel(QString::fromStdString(bits_range), this));
+        const RegField &field = fields[i];
+        auto desc_type = field.desc_type;
+        QString cell_name_prefix = name_prefix + "_bits[" + field.range + "]";
+        uint64_t curr_value = field.extract(current_value);
+        uint64_t value_max = field.max_value();
+        bool is_readonly = field.readonly;
+
+        this->m_ranges.push_back(new QLabel(field.range, this));
         this->m_ranges.back()->setObjectName(cell_name_prefix);
         this->setCellWidget(i, 0, this->m_ranges.back());
 
         this->m_def_values.push_back(new BigSpinBox(BigSpinBox::ShowStyle::HEX, this));
         this->m_def_values.back()->setObjectName(cell_name_prefix + "_defval");
         this->m_def_values.back()->setReadOnly(true);
-        this->m_def_values.back()->setStyleSheet("background-color: darkgray; color: white;");
+        this->m_def_values.back()->setProperty("access", "ro");
         this->m_def_values.back()->setRange(0, value_max);
-        this->m_def_values.back()->setValue(
-            extract_from_full_value(default_value, range_pair.first, range_pair.second));
+        this->m_def_values.back()->setValue(field.extract(default_value));
         this->setCellWidget(i, 1, this->m_def_values.back());
 
         this->m_curr_values.push_back(new BigSpinBox(BigSpinBox::ShowStyle::HEX, this));
         this->m_curr_values.back()->setObjectName(cell_name_prefix + "_currval");
-        if (is_readonly)
-        {
-            this->m_curr_values.back()->setReadOnly(true);
-            this->m_curr_values.back()->setStyleSheet("background-color: darkgray; color: white;");
-        }
-        else
-        {
-            this->m_curr_values.back()->setStyleSheet("background-color: " SOFT_GREEN_COLOR "; color: black;");
-        }
+        this->m_curr_values.back()->setReadOnly(is_readonly);
+        this->m_curr_values.back()->setProperty("access", is_readonly ? "ro" : "rw");
         this->m_curr_values.back()->setRange(0, value_max);
         this->m_curr_values.back()->setValue(curr_value);
+        this->m_curr_values.back()->setProperty("field_index", i);
         this->setCellWidget(i, 2, this->m_curr_values.back());
-        this->connect(this->m_curr_values.back(), SIGNAL(textChanged(const QString &)),
-            this, SLOT(on_currval_textChanged(const QString &)));
+        this->connect(this->m_curr_values.back(), SIGNAL(valueChanged(uint64_t)),
+            this, SLOT(on_currval_valueChanged(uint64_t)));
 
         if (desc_type > BITS_ITEM_DESC_RESERVED)
         {
             BigSpinBox::ShowStyle show_style = (BITS_ITEM_DESC_DECIMAL == desc_type) ? BigSpinBox::ShowStyle::DECIMAL
                 : ((BITS_ITEM_DESC_UDECIMAL == desc_type) ? BigSpinBox::ShowStyle::UDECIMAL
                     : BigSpinBox::ShowStyle::HEX);
-            bool enumerable = (desc_type >= BITS_ITEM_DESC_ENUM && desc_type <= BITS_ITEM_DESC_INVBOOL);
-            QJsonObject bool_dict({ { "0", "false" }, { "1", "true" } });
-            QJsonObject invbool_dict({ { "0", "true" }, { "1", "false" } });
-            const QJsonObject &enum_dict = (BITS_ITEM_DESC_ENUM == desc_type) ? dict.value("desc").toObject()
-                : ((BITS_ITEM_DESC_BOOL == desc_type) ? bool_dict : invbool_dict);
 
             this->m_desc_items.push_back(
-                new RegBitsDescCell(this, cell_name_prefix, attr_arr[3].toString(),
-                    (attr_size > 4) ? attr_arr[4].toString() : "",
-                    curr_value, value_max, show_style, (enumerable ? &enum_dict : nullptr), is_readonly)
+                new RegBitsDescCell(this, cell_name_prefix, field.title, field.hint,
+                    curr_value, value_max, show_style, field.enum_def, is_readonly)
             );
+            this->m_desc_items.back()->setProperty("field_index", i);
+            this->connect(this->m_desc_items.back(), SIGNAL(valueChanged(uint64_t)),
+                this, SLOT(on_desc_valueChanged(uint64_t)));
             this->setRowHeight(i, resize_table_height(
                 dynamic_cast<RegBitsDescCell *>(this->m_desc_items.back()), /* header_row_visible = */false));
         }
         else
         {
-            this->m_desc_items.push_back(new QLabel(QString::fromStdString(desc_type_str), this));
+            this->m_desc_items.push_back(new QLabel(field.title, this));
             this->m_desc_items.back()->setObjectName(cell_name_prefix + "_desc");
         }
         this->setCellWidget(i, 3, this->m_desc_items.back());
-    } // for (int i : dict_value.count())
+    } // for (int i : fields.size())
 }
 
 RegBitsTable::~RegBitsTable()
@@ -717,56 +498,155 @@ RegBitsTable::~RegBitsTable()
     std::vector<QWidget *>().swap(m_desc_items);
 }
 
-void RegBitsTable::on_currval_textChanged(const QString &text)
+bool RegBitsTable::annotate(const QString &bits_range, const QString &note)
+{
+    for (size_t i = 0; i < m_fields.size(); ++i)
+    {
+        if (bits_range != m_fields[i].range)
+            continue;
+
+        const QString &tool_tip = m_ranges[i]->toolTip().isEmpty() ? note : (m_ranges[i]->toolTip() + "\n\n" + note);
+
+        set_style_property(m_ranges[i], "flagged", true);
+        m_ranges[i]->setToolTip(tool_tip);
+        m_curr_values[i]->setToolTip(tool_tip);
+
+        return true;
+    }
+
+    qtCWarnV(::, "%s: No such a bits range: %s", this->objectName().toStdString().c_str(),
+        bits_range.toStdString().c_str());
+
+    return false;
+}
+
+void RegBitsTable::rebind(uint64_t default_value, uint64_t current_value)
 {
-    auto *changed_bits = dynamic_cast<BigSpinBox *>(this->sender()/* QObject::sender() */);
-    std::pair<int8_t, int8_t> bits_range_pair;
-    RegBitsDescCell *desc_cell = nullptr;
-    QLabel *desc_label = nullptr;
+    this->setUpdatesEnabled(false);
 
-    for (size_t i = 0; i < m_curr_values.size(); ++i)
+    for (size_t i = 0; i < m_fields.size(); ++i)
     {
-        if (changed_bits == m_curr_values[i])
-        {
-            QWidget *desc_item = m_desc_items[i];
+        const QSignalBlocker blocker(m_def_values[i]);
+
+        set_style_property(m_ranges[i], "flagged", false);
+        m_ranges[i]->setToolTip("");
+        m_curr_values[i]->setToolTip("");
+        m_def_values[i]->setValue(m_fields[i].extract(default_value));
+    }
 
-            desc_cell = dynamic_cast<RegBitsDescCell *>(desc_item);
-            desc_label = dynamic_cast<QLabel *>(desc_item);
+    this->setUpdatesEnabled(true);
 
-            bits_range_pair = check_bits_range(m_ranges[i]->text().toStdString().c_str());
+    this->set_value(current_value);
+}
+
+void RegBitsTable::set_value(uint64_t full_value)
+{
+    this->commit(full_value, nullptr);
+}
+
+void RegBitsTable::set_field(size_t index, uint64_t bits_value)
+{
+    if (m_updating || index >= m_fields.size())
+        return;
 
-            break;
+    auto *desc_cell = dynamic_cast<RegBitsDescCell *>(m_desc_items[index]);
+    uint64_t full_value = m_fields[index].merge(m_value, bits_value);
+
+    m_updating = true;
+
+    {
+        const QSignalBlocker blocker(m_curr_values[index]);
+
+        m_curr_values[index]->setValue(bits_value);
+    }
+
+    if (desc_cell)
+        desc_cell->sync(bits_value);
+
+    qtCDebugV(::, "%s: 0x%lx => 0x%lx", this->objectName().toStdString().c_str(), m_value, full_value);
+    m_value = full_value;
+
+    m_updating = false;
+
+    emit this->valueChanged(full_value);
+}
+
+void RegBitsTable::edit_value(uint64_t full_value)
+{
+    uint64_t old_value = m_value;
+
+    if (m_updating || full_value == old_value)
+        return;
+
+    this->commit(full_value, this->sender()/* QObject::sender() */);
+    emit this->edited(old_value, full_value);
+}
+
+void RegBitsTable::commit(uint64_t full_value, QObject *emitter)
+{
+    if (m_updating)
+        return;
+
+    m_updating = true;
+    this->setUpdatesEnabled(false); // repainted once at the end
+
+    for (size_t i = 0; i < m_fields.size(); ++i)
+    {
+        uint64_t bits_value = m_fields[i].extract(full_value);
+        auto *desc_cell = dynamic_cast<RegBitsDescCell *>(m_desc_items[i]);
+
+        // The emitter itself already shows the new value, and resetting its text would disturb typing.
+        if (emitter != m_curr_values[i])
+        {
+            const QSignalBlocker blocker(m_curr_values[i]);
+
+            m_curr_values[i]->setValue(bits_value);
         }
+
+        if (desc_cell && emitter != desc_cell)
+            desc_cell->sync(bits_value);
     }
 
-    const std::string &bits_obj_name = changed_bits ? changed_bits->objectName().toStdString() : "<UNKNOWN>";
+    qtCDebugV(::, "%s: 0x%lx => 0x%lx", this->objectName().toStdString().c_str(), m_value, full_value);
+    m_value = full_value;
 
-    if (nullptr == desc_cell && nullptr == desc_label)
+    this->setUpdatesEnabled(true);
+    m_updating = false;
+
+    emit this->valueChanged(full_value);
+}
+
+void RegBitsTable::change_field(QObject *emitter, uint64_t bits_value)
+{
+    if (m_updating)
+        return;
+
+    bool ok = false;
+    int index = emitter ? emitter->property("field_index").toInt(&ok) : -1;
+
+    if (!ok || index < 0 || index >= static_cast<int>(m_fields.size()))
     {
-        qtCErrV(::, "Can not match a desc widget with emitter: %s", bits_obj_name.c_str());
+        qtCErrV(::, "Can not match a bits item with emitter: %s",
+            emitter ? emitter->objectName().toStdString().c_str() : "<UNKNOWN>");
 
         return;
     }
 
-    const std::string &text_str = text.toStdString();
-    uint64_t bits_value = strtoull(text_str.c_str(), nullptr, text.startsWith("0x") ? 16 : 10);
-    auto *outer_table = dynamic_cast<QTableWidget *>(this->parentWidget()->parentWidget());
-    auto *full_values_table = dynamic_cast<RegFullValuesRow *>(outer_table->cellWidget(1, 0));
-    uint64_t full_value = full_values_table->current_value();
-    uint64_t mask_high = u64_lshift(UINT64_MAX, bits_range_pair.first + 1);
-    uint64_t mask_low = u64_rshift(UINT64_MAX, 64 - bits_range_pair.second);
-    uint64_t mask = mask_high | mask_low;
-    uint64_t full_value_updated = (full_value & mask) | (bits_value << bits_range_pair.second);
+    uint64_t old_value = m_value;
 
-    qtCDebugV(::, "%s: text = %s, bits_value = 0x%lx, mask_high = 0x%lx, mask_low = 0x%lx, mask = 0x%lx,"
-        " full_value = 0x%lx, result = 0x%lx\n",
-        bits_obj_name.c_str(), text_str.c_str(), bits_value, mask_high, mask_low, mask,
-        full_value, full_value_updated);
+    this->commit(m_fields[index].merge(m_value, bits_value), emitter);
+    if (m_value != old_value)
+        emit this->edited(old_value, m_value);
+}
 
-    full_values_table->sync(full_value_updated);
+void RegBitsTable::on_currval_valueChanged(uint64_t bits_value)
+{
+    this->change_field(this->sender()/* QObject::sender() */, bits_value);
+}
 
-    if (desc_cell)
-        desc_cell->sync(bits_value);
+void RegBitsTable::on_desc_valueChanged(uint64_t bits_value)
+{
+    this->change_field(this->sender()/* QObject::sender() */, bits_value);
 }
 
 /******************************** RegBitsTable end ********************************/
@@ -792,5 +672,26 @@ void RegBitsTable::on_currval_textChanged(const QString &text)
  * >>> 2025-04-08, Man Hung-Coeng <udc577@126.com>:
  *  01. Remove the trailing newline character from each log message.
  *  02. Remove module prefix of each Qt header files to improve robustness.
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Move the parsing and validation of bits items into reg_schema.cpp
+ *      for sharing with the headless modes.
+ *  02. Replace the bit mask arithmetic with that of compiled bits items.
+ *  03. Add RegBitsTable::annotate() to highlight fields flagged by stats biz.
+ *  04. Build enum pull-down lists from shared enum definitions instead of
+ *      JSON dictionaries, which also fixes the index of the "Others" option.
+ *  05. Share one immutable item model among pull-down lists of the same
+ *      enum definition, and sync them via the hash index of enum values.
+ *  06. Propagate value changes among bits items, descriptions and the
+ *      full-values row in one transaction via RegBitsTable::set_value(),
+ *      with signals blocked instead of being disconnected and reconnected.
+ *  07. Make BigSpinBox value-native: keep and emit uint64_t values directly,
+ *      and format texts only when values change, without parsing them back.
+ *  08. Add RegBitsTable::rebind() and RegFullValuesRow::rebind() to reset
+ *      pooled register tables with new values instead of rebuilding them.
+ *  09. Replace per-widget style sheets with dynamic properties selected by
+ *      one application-level style sheet, and share fonts of titles.
+ *  10. Make the current full value editable, and emit RegBitsTable::edited()
+ *      on changes made by the user for the undo/redo journal.
  */
 
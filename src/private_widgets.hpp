@@ -24,12 +24,31 @@
 #include <QLineEdit>
 #include <QLabel>
 
+#include "reg_schema.hpp"
+
 class QComboBox;
 
 #define SOFT_GREEN_COLOR                        "#c7edcc"
 
 int resize_table_height(QTableWidget *table, bool header_row_visible);
 
+/*
+ * Application-level style sheet of register tables and input boxes, which is parsed only once,
+ * while widgets select their looks by dynamic properties instead of style sheets of their own:
+ *   access:   "ro" or "rw", for value boxes;
+ *   role:     "title" for register titles, "desc_title" for titles of descriptions;
+ *   hinted:   true for description titles with hints;
+ *   flagged:  true for register titles and bits ranges flagged by validation or stats.
+ */
+const char* reg_tables_style_sheet(void);
+
+// Sets a dynamic property selected by reg_tables_style_sheet(), and re-polishes the widget if needed.
+void set_style_property(QWidget *widget, const char *name, const QVariant &value);
+
+// Fonts shared by all titles instead of being created for each one.
+const QFont& register_title_font(void);
+const QFont& hinted_title_font(void);
+
 class BigSpinBox : public QSpinBox
 {
     Q_OBJECT
@@ -65,6 +84,15 @@ public:
         {
             this->setDisplayIntegerBase(10);
         }
+
+        this->connect(this->lineEdit(), SIGNAL(textEdited(const QString &)),
+            this, SLOT(on_lineedit_textEdited(const QString &)));
+    }
+
+    // For widgets promoted from QSpinBox in *.ui files.
+    explicit BigSpinBox(QWidget *parent)
+        : BigSpinBox(HEX, parent)
+    {
     }
 
 public:
@@ -136,7 +164,10 @@ public Q_SLOTS:
     void setValue(uint64_t val);
 
 Q_SIGNALS:
-  void valueChanged(uint64_t); // optional, only needed if Q_PROPERTY(... setValue ..) above contains NOTIFY
+    void valueChanged(uint64_t); // emitted on changes via both setValue() and typing, instead of textChanged()
+
+private slots:
+    void on_lineedit_textEdited(const QString &text);
 
 private:
     enum ShowStyle m_show_style;
@@ -157,8 +188,18 @@ public:
 
     ~RegFullValuesRow();
 
+    // Shows the value without emitting valueChanged().
     inline void sync(uint64_t current_value)
     {
+        const QSignalBlocker blocker(m_curr_value);
+
+        m_curr_value.setValue(current_value);
+    }
+
+    // For reusing a pooled row.
+    inline void rebind(uint64_t default_value, uint64_t current_value)
+    {
+        m_def_value.setValue(default_value);
         m_curr_value.setValue(current_value);
     }
 
@@ -167,6 +208,12 @@ public:
         return m_curr_value.value();
     }
 
+    // Emits valueChanged() on full values typed or pasted by the user.
+    inline BigSpinBox* current_value_box(void)
+    {
+        return &m_curr_value;
+    }
+
 private:
     QLabel m_def_label;
     BigSpinBox m_def_value;
@@ -186,16 +233,20 @@ public:
 
     RegBitsDescCell(QWidget *parent, const QString &name_prefix, const QString &title, const QString &hint,
         uint64_t value, uint64_t value_max, BigSpinBox::ShowStyle style,
-        const QJsonObject *enum_dict, bool is_readonly);
+        const RegEnum *enum_def, bool is_readonly);
 
     RegBitsDescCell(RegBitsDescCell &&src);
 
     ~RegBitsDescCell();
 
+    // Shows the value without emitting valueChanged().
     void sync(uint64_t value);
 
+Q_SIGNALS:
+    void valueChanged(uint64_t); // only for changes made by the user
+
 private slots:
-    void on_digitbox_textChanged(const QString &text);
+    void on_digitbox_valueChanged(uint64_t value);
 
     void on_enumbox_currentIndexChanged(int index);
 
@@ -203,9 +254,7 @@ private:
     QLineEdit m_title;
     BigSpinBox *m_digit;
     QComboBox *m_enum;
-    std::vector<uint64_t> m_enum_values;
-    uint16_t m_badvalue_index;
-    static const uint16_t INVALID_INDEX = 0xffff;
+    const RegEnum *m_enum_def; // shared by identical definitions, nullptr if not enumerable
 };
 
 class RegBitsTable : public QTableWidget
@@ -224,10 +273,54 @@ public:
 
     ~RegBitsTable();
 
+    inline uint64_t value(void) const
+    {
+        return m_value;
+    }
+
+    inline const std::vector<RegField>& fields(void) const
+    {
+        return m_fields;
+    }
+
+    // Applies a new register value to all fields and descriptions in one transaction, and emits valueChanged() once.
+    void set_value(uint64_t full_value);
+
+    // Highlights the bits range and appends the note to tool tips. Returns false if no such a range.
+    bool annotate(const QString &bits_range, const QString &note);
+
+    /*
+     * Clears annotations and applies new default and current values, for reusing a pooled table
+     * of the same field layout instead of building a new one. Emits valueChanged() once.
+     */
+    void rebind(uint64_t default_value, uint64_t current_value);
+
+    // Applies a new value to one field, and updates only its own row. Emits valueChanged() once.
+    void set_field(size_t index, uint64_t bits_value);
+
+public Q_SLOTS:
+    // Applies a full value typed or pasted by the user as one edit.
+    void edit_value(uint64_t full_value);
+
+Q_SIGNALS:
+    void valueChanged(uint64_t);
+
+    void edited(uint64_t old_value, uint64_t new_value); // only for changes made by the user
+
 private slots:
-    void on_currval_textChanged(const QString &text);
+    void on_currval_valueChanged(uint64_t bits_value);
+
+    void on_desc_valueChanged(uint64_t bits_value);
 
 private:
+    void commit(uint64_t full_value, QObject *emitter);
+
+    void change_field(QObject *emitter, uint64_t bits_value);
+
+private:
+    uint64_t m_value;
+    bool m_updating; // to ignore signals triggered by set_value() itself
+    std::vector<RegField> m_fields;
     std::vector<QLabel *> m_ranges;
     std::vector<BigSpinBox *> m_def_values;
     std::vector<BigSpinBox *> m_curr_values;
@@ -250,5 +343,21 @@ private:
  *
  * >>> 2025-04-08, Man Hung-Coeng <udc577@126.com>:
  *  01. Remove module prefix of each Qt header files to improve robustness.
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Add a constructor of BigSpinBox for promotion in *.ui files,
+ *      and keep its value in sync with what the user types.
+ *  02. Keep compiled bits items in RegBitsTable for the bit mask arithmetic.
+ *  03. Add RegBitsTable::annotate().
+ *  04. Pass shared enum definitions to RegBitsDescCell.
+ *  05. Replace m_enum_values and m_badvalue_index of RegBitsDescCell
+ *      with the shared enum definition.
+ *  06. Add RegBitsTable::set_value() and valueChanged() signals to propagate
+ *      updates in one transaction instead of chains of signals.
+ *  07. Make BigSpinBox emit valueChanged(uint64_t) rather than textChanged().
+ *  08. Add rebind() to RegFullValuesRow and RegBitsTable for recycling register tables.
+ *  09. Add reg_tables_style_sheet(), set_style_property() and shared title fonts.
+ *  10. Add RegBitsTable::edited() signal, edit_value() and set_field()
+ *      for the undo/redo journal.
  */
 
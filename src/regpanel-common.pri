@@ -0,0 +1,23 @@
+#
+# Settings shared by regpanel.pro and core/regpanel-core.pro, so that the core library
+# is compiled with the same logger settings and warnings as the app it's linked into.
+#
+# Copyright (c) 2026 agent <agent@local>
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# $(__VER__) is expanded by make instead of qmake, see __ver__.mk and the core library rule in Makefile.
+DEFINES += __VER__=\\\"$(__VER__)\\\" HAS_LOGGER
+QMAKE_CFLAGS_WARN_ON += -Wno-unused-parameter
+QMAKE_CXXFLAGS_WARN_ON += -Wno-unused-parameter
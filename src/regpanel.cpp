@@ -22,13 +22,20 @@
 
 #include <QDir>
 #include <QtGui>
+#include <QApplication>
 #include <QLabel>
 #include <QMessageBox>
 #include <QTableWidget>
 #include <QHeaderView>
+#include <QScrollBar>
+#include <QTimer>
 
 #include "qt_print.hpp"
 #include "private_widgets.hpp"
+#include "soc_map.hpp"
+#include "reg_codec.hpp"
+#include "reg_decoder.hpp"
+#include "reg_archive.hpp"
 
 #if 0
 #define ABORT(errcode)                          QApplication::exit(errcode)
@@ -36,14 +43,38 @@
 #define ABORT(errcode)                          exit(errcode)
 #endif
 
+// Hidden tables beyond this number are destroyed instead of being pooled.
+#define MAX_POOLED_REG_TABLES                   512
+
+#define MAX_SEARCH_HITS                         200
+
+#define SESSION_AUTOSAVE_INTERVAL_MS            30000
+
+// Half for configuration files, and half for register tables. Overridden by set_prefetch_cap().
+#define DEFAULT_PREFETCH_CAP                    (64 << 20)
+
+// A rough estimate of widgets, items and style data of a table row.
+#define ESTIMATED_BYTES_PER_TABLE_ROW           (16 << 10)
+
+// Few enough to keep the GUI responsive while pre-building.
+#define PREBUILT_TABLES_PER_TICK                4
+
 RegPanel::RegPanel(const char *config_dir, QWidget *parent)
     : QDialog(parent)
     , m_config_dir(config_dir)
+    , m_filtered_count(0)
+    , m_autosave_timer(nullptr)
+    , m_prefetcher(DEFAULT_PREFETCH_CAP / 2)
+    , m_prebuild_timer(nullptr)
+    , m_prebuild_cap(DEFAULT_PREFETCH_CAP / 2)
+    , m_pooled_bytes(0)
+    , m_started(false)
     , m_prev_vendor_idx(-1)
     , m_prev_chip_idx(-1)
     , m_prev_file_idx(-1)
     , m_prev_module_idx(-1)
 {
+    qApp->setStyleSheet(reg_tables_style_sheet()); // parsed once for all widgets
     setupUi(this);
 
     this->setFixedSize(this->geometry().size());
@@ -51,16 +82,59 @@ RegPanel::RegPanel(const char *config_dir, QWidget *parent)
     this->setWindowTitle(QString::asprintf("%s [%s]", this->windowTitle().toStdString().c_str(), FULL_VERSION()));
     this->lblPoweredBy->setText(this->lblPoweredBy->text() + " " + QT_VERSION_STR);
     this->scrlViewContents->setLayout(this->vlayoutRegTables);
+    this->spnboxAddrBase->setPrefix(""); // Already shown by txtAddrBaseHint.
+    this->spnboxAddrBase->setRange(0, UINT64_MAX);
+    this->btnUndo->setShortcut(QKeySequence::Undo);
+    this->btnRedo->setShortcut(QKeySequence::Redo);
+
+    this->m_view_filter.mode = REG_FILTER_ALL;
+
+    this->m_prebuild_timer = new QTimer(this);
+    this->m_prebuild_timer->setInterval(0); // fired whenever the event loop is idle
+    this->connect(this->m_prebuild_timer, SIGNAL(timeout()), this, SLOT(prebuild_register_tables()));
+
+    /*
+     * The window is shown right away, while the configuration directory is scanned and the file selected
+     * by default is parsed and compiled in background. Widgets are disabled until finish_startup().
+     */
+    this->tab->setEnabled(false);
+    this->m_startup_loader = std::thread([this]() {
+        auto result = std::make_shared<StartupResult>();
+        QString err_msg;
+
+        if (scan_config_directory(this->m_config_dir, result->vendors, &result->err_msg))
+        {
+            const auto &vendors = result->vendors;
 
-    scan_config_directory(config_dir);
+            // The same one as selected by the cascade of index changes.
+            if (!vendors.front().second.empty() && !vendors.front().second.front().second.empty())
+            {
+                const ChipItem &chip = vendors.front().second.front();
+
+                result->first_config.reset(new PreloadedConfig);
+                result->first_config->path = config_file_path(this->m_config_dir,
+                    QString::fromStdString(vendors.front().first), QString::fromStdString(chip.first),
+                    QString::fromStdString(chip.second.front()));
+                if (load_reg_config(result->first_config->path, result->first_config->config, &err_msg,
+                    &result->first_config->json, &result->first_config->stamps) < 0)
+                {
+                    qtCWarnV(::, "%s", err_msg.toStdString().c_str()); // to be reported when loaded again
+                    result->first_config.reset();
+                }
+            }
+        }
 
-    emit this->lstVendor->currentIndexChanged(-1);
-    emit this->lstAddrBaseMethod->currentIndexChanged(this->lstAddrBaseMethod->currentIndex());
-    emit this->chkboxAsInput->stateChanged(this->chkboxAsInput->isChecked());
+        QMetaObject::invokeMethod(this, [this, result]() {
+            this->finish_startup(result);
+        }, Qt::QueuedConnection);
+    });
 }
 
 RegPanel::~RegPanel()
 {
+    if (this->m_startup_loader.joinable())
+        this->m_startup_loader.join();
+
     //this->clear_register_tables(); // FIXME: Seems unnecessary.
     //delete this->scrollArea; // FIXME: Same with this and other widgets made by *.ui file.
     // NOTE: Certainly there're some memory leaks, but it's too few to worry.
@@ -92,7 +166,15 @@ void RegPanel::closeEvent(QCloseEvent *event)/* override */
         this, "", "Exit now ?", QMessageBox::Yes | QMessageBox::No);
 
     if (QMessageBox::Yes == button)
+    {
+        if (this->m_autosave_timer && this->m_started)
+        {
+            this->m_autosave_timer->stop();
+            this->m_session_autosaver.submit(this->capture_session());
+            this->m_session_autosaver.stop(); // flushed before exiting
+        }
         event->accept();
+    }
     else
         event->ignore();
 }
@@ -131,16 +213,8 @@ void RegPanel::on_tab_currentChanged(int index)
     this->m_prev_module_idx = module_idx;
 
     const QString &module_name = this->lstModule->currentText();
-    const QJsonObject &modules_dict = this->json().object().value(module_name).toObject();
-
-    this->m_reg_addr_map.clear();
-    for (const QString &k : modules_dict.keys())
-    {
-        const std::string &key = k.toStdString();
 
-        if (!k.startsWith("__"))
-            this->m_reg_addr_map[strtoull(key.c_str(), nullptr, 16)] = key;
-    }
+    this->update_reg_addr_map(module_name);
 
     if (this->chkboxAsInput->isChecked())
         return;
@@ -149,10 +223,10 @@ void RegPanel::on_tab_currentChanged(int index)
 
     int count = this->make_register_tables(this->json(), module_name);
 
-    if (count > 0)
+    if (count > 0 || this->m_filtered_count > 0)
     {
-        this->info_box("Load",
-            QString::asprintf("Loaded %d register tables for module:\n\n%s", count, module_name.toStdString().c_str()));
+        this->info_box("Load", QString::asprintf("Loaded %d register tables (%d filtered out) for module:\n\n%s",
+            count, this->m_filtered_count, module_name.toStdString().c_str()));
     }
     else
     {
@@ -160,7 +234,7 @@ void RegPanel::on_tab_currentChanged(int index)
             QString::asprintf("Failed to load register tables for module:\n\n%s", module_name.toStdString().c_str()));
     }
 
-    this->grpboxView->setTitle(QString::asprintf("View: %d item(s) below", (count >= 0) ? count : 0));
+    this->update_view_title(count);
 }
 
 void RegPanel::on_lstVendor_currentIndexChanged(int index)
@@ -250,10 +324,8 @@ void RegPanel::on_lstModule_currentIndexChanged(int index)
         this->lstModule->clear();
         if (vendor_idx >= 0 && chip_idx >= 0 && file_idx >= 0)
         {
-            QString path = QString::fromStdString(this->config_dir()) + QDir::separator()
-                + this->lstVendor->currentText() + QDir::separator()
-                + this->lstChip->currentText() + QDir::separator()
-                + this->lstFile->currentText();
+            QString path = config_file_path(this->config_dir(), this->lstVendor->currentText(),
+                this->lstChip->currentText(), this->lstFile->currentText());
 
             if (this->load_config_file(path.toStdString().c_str()))
             {
@@ -263,6 +335,8 @@ void RegPanel::on_lstModule_currentIndexChanged(int index)
                 {
                     this->lstModule->addItem(m.toString());
                 }
+
+                this->schedule_prefetch(vendor_idx, chip_idx, file_idx);
             }
 
             if (this->lstModule->count() > 0)
@@ -284,34 +358,29 @@ void RegPanel::on_lstDelimeter_currentIndexChanged(int index)
 
 void RegPanel::on_lstAddrBaseMethod_currentIndexChanged(int index)
 {
-    bool ignored = (0 == this->lstAddrBaseMethod->itemText(index).compare("Ignore", Qt::CaseInsensitive));
+    const QString &method = this->lstAddrBaseMethod->itemText(index);
+    // Each module brings its own base in the SoC map, so the one in spin box makes no sense for "Global".
+    bool ignored = (0 == method.compare("Ignore", Qt::CaseInsensitive)
+        || 0 == method.compare("Global", Qt::CaseInsensitive));
 
     this->spnboxAddrBase->setDisabled(ignored);
     this->spnboxAddrBase->setReadOnly(ignored);
-    this->spnboxAddrBase->setStyleSheet(ignored ? "background-color: darkgray; color: white;"
-        : "background-color: " SOFT_GREEN_COLOR "; color: black;");
+    set_style_property(this->spnboxAddrBase, "access", ignored ? "ro" : "rw");
 }
 
-enum
-{
-    CURLY_BRACES,
-    SQUARE_BRACKETS
-};
-
 void RegPanel::on_chkboxAsInput_stateChanged(int checked)
 {
     QPalette palette = this->txtInput->palette();
     int delim_index = this->lstDelimeter->currentIndex();
-    char left_delim = (CURLY_BRACES == delim_index) ? '{' : '[';
-    char right_delim = (CURLY_BRACES == delim_index) ? '}' : ']';
+    char left_delim = left_delimiter(delim_index);
+    char right_delim = right_delimiter(delim_index);
     QString placeholder_text = checked ? QString::asprintf("Input Address-Value pairs here. For example:\n"
             "%c 0x0040, 0x0101 %c,\n%c 0x0080, 0xabab %c", left_delim, right_delim, left_delim, right_delim)
         : QString("");
 
     this->txtInput->setPlaceholderText(placeholder_text);
     this->txtInput->setReadOnly(!checked);
-    this->txtInput->setStyleSheet(checked ? "background-color: " SOFT_GREEN_COLOR "; color: black;"
-        : "background-color: darkgray; color: white;");
+    set_style_property(this->txtInput, "access", checked ? "rw" : "ro");
     palette.setColor(QPalette::PlaceholderText, QColor("darkgray"));
     this->txtInput->setPalette(palette);
 }
@@ -332,12 +401,15 @@ void RegPanel::on_btnConvert_clicked(void)
     {
         this->clear_register_tables();
 
-        if ((count = this->make_register_tables(*this->txtInput, module_name)) > 0)
-            this->info_box("Convert", QString::asprintf("Converted %d register tables from text box.", count));
+        if ((count = this->make_register_tables(*this->txtInput, module_name)) > 0 || this->m_filtered_count > 0)
+        {
+            this->info_box("Convert", QString::asprintf("Converted %d register tables (%d filtered out) from text box.",
+                count, this->m_filtered_count));
+        }
         else
             this->error_box("Convert", "Failed to convert register tables from text box!");
 
-        this->grpboxView->setTitle(QString::asprintf("View: %d item(s) below", (count >= 0) ? count : 0));
+        this->update_view_title(count);
     }
     else
     {
@@ -348,419 +420,1009 @@ void RegPanel::on_btnConvert_clicked(void)
     }
 }
 
-void RegPanel::scan_config_directory(const char *config_dir)
+void RegPanel::on_edtSearch_textChanged(const QString &text)
 {
-    QDir dir(config_dir);
+    this->m_search_hits = this->m_search_index.search(text, MAX_SEARCH_HITS);
 
-    if (!dir.exists())
+    this->lstSearchResult->setUpdatesEnabled(false);
+    this->lstSearchResult->clear();
+    for (size_t i = 0; i < this->m_search_hits.size(); ++i)
     {
-        this->error_box("Directory Error", QString::asprintf("Non-existent or unreadable directory:\n\n%s", config_dir));
+        const RegSearchIndex::Entry &hit = this->m_search_hits[i];
+        auto *item = new QListWidgetItem(QString::asprintf("%s  @  0x%lx  [%s: %s]",
+            hit.reg_key.toStdString().c_str(), hit.addr,
+            hit.path.toStdString().c_str(), hit.module.toStdString().c_str()), this->lstSearchResult);
 
-        ABORT(EXIT_FAILURE);
+        item->setData(Qt::UserRole, QVariant::fromValue<qulonglong>(i));
     }
+    if (this->m_search_hits.empty() && !text.trimmed().isEmpty() && this->m_search_index.building())
+        this->lstSearchResult->addItem("(Still indexing, please try again later ...)");
+    this->lstSearchResult->setUpdatesEnabled(true);
+}
 
-    char dir_delim = QDir::separator().toLatin1();
-    auto dir_filters = QDir::Filter::Dirs | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
-    auto file_filters = QDir::Filter::Files | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
-    auto sort_flags = QDir::SortFlag::Name;
-    const auto &vendors = dir.entryList(dir_filters, sort_flags);
+void RegPanel::on_lstSearchResult_itemActivated(QListWidgetItem *item)
+{
+    bool ok = false;
+    size_t index = item->data(Qt::UserRole).toULongLong(&ok);
 
-    if (vendors.empty())
+    if (!ok || index >= this->m_search_hits.size())
+        return;
+
+    const RegSearchIndex::Entry hit = this->m_search_hits[index]; // copied in case of being refreshed by signals
+    const QStringList &path_parts = hit.path.split('/');
+
+    if (3 != path_parts.size())
+        return;
+
+    // Each change cascades down to the next list, and loads the configuration file on changing the file.
+    this->lstVendor->setCurrentText(path_parts[0]);
+    this->lstChip->setCurrentText(path_parts[1]);
+    this->lstFile->setCurrentText(path_parts[2]);
+    this->lstModule->setCurrentText(hit.module);
+
+    if (this->lstFile->currentText() != path_parts[2] || this->lstModule->currentText() != hit.module)
     {
-        this->error_box("Directory Error", QString::asprintf("No readable vendor directories within:\n\n%s", config_dir));
+        this->error_box("Search", "Failed to locate the register:\n\n" + hit.reg_key + "\n\nin " + hit.path);
 
-        ABORT(EXIT_FAILURE);
+        return;
     }
 
-    this->m_vendors.reserve(vendors.count());
-    for (const auto &vendor_name : vendors)
-    {
-        auto v = this->m_vendors.insert(this->m_vendors.end(), { vendor_name.toStdString(), std::vector<ChipItem>() });
-        QDir vdir(QString::asprintf("%s%c%s", dir.path().toStdString().c_str(), dir_delim, v->first.c_str()));
-        const auto &chips = vdir.entryList(dir_filters, sort_flags);
+    this->update_reg_addr_map(hit.module);
+    this->clear_register_tables();
 
-        if (chips.empty())
-            continue;
+    int count = this->make_register_tables(this->json(), hit.module, hit.reg_key);
 
-        v->second.reserve(chips.count());
-        for (const auto &chip_name : chips)
-        {
-            auto c = v->second.insert(v->second.end(), { chip_name.toStdString(), std::vector<std::string>() });
-            QDir cdir(QString::asprintf("%s%c%s", vdir.path().toStdString().c_str(), dir_delim, c->first.c_str()));
-            const auto &files = cdir.entryList(file_filters, sort_flags);
+    this->update_view_title(count);
 
-            if (files.empty())
-                continue;
+    // Marked as shown, so that switching to the view page won't make tables of the whole module again.
+    this->m_prev_vendor_idx = this->lstVendor->currentIndex();
+    this->m_prev_chip_idx = this->lstChip->currentIndex();
+    this->m_prev_file_idx = this->lstFile->currentIndex();
+    this->m_prev_module_idx = this->lstModule->currentIndex();
+    this->tab->setCurrentIndex(1);
+}
 
-            c->second.reserve(files.count());
-            for (const auto &file_name : files)
-            {
-                c->second.push_back(file_name.toStdString());
-            }
-        }
-    }
+void RegPanel::on_lstViewFilter_currentIndexChanged(int index)
+{
+    this->m_view_filter.mode = (index < 0) ? REG_FILTER_ALL : static_cast<RegFilterMode>(index);
+    this->refresh_register_tables();
 }
 
-bool RegPanel::load_config_file(const char *path)
+void RegPanel::on_edtViewFilter_editingFinished(void)
 {
-    QFile file(path);
+    const QString &text = this->edtViewFilter->text().trimmed();
 
-    if (!file.open(QIODevice::ReadOnly))
-    {
-        this->error_box("File Error",
-            QString::asprintf("Failed to read file:\n\n%s\n\nReason:\n\n", path) + file.errorString());
+    if (text == this->m_view_filter.text)
+        return;
 
-        return false;
+    this->m_view_filter.text = text;
+    this->refresh_register_tables();
+}
+
+void RegPanel::on_btnUndo_clicked(void)
+{
+    std::vector<RegEditJournal::Entry> deltas;
+
+    if (this->m_edit_journal.undo(deltas) > 0)
+        this->apply_register_edits(deltas, /* is_redo = */false);
+
+    this->update_undo_buttons();
+}
+
+void RegPanel::on_btnRedo_clicked(void)
+{
+    std::vector<RegEditJournal::Entry> deltas;
+
+    if (this->m_edit_journal.redo(deltas) > 0)
+        this->apply_register_edits(deltas, /* is_redo = */true);
+
+    this->update_undo_buttons();
+}
+
+void RegPanel::record_register_edit(uint64_t old_value, uint64_t new_value)
+{
+    auto *bits_table = dynamic_cast<RegBitsTable *>(this->sender()/* QObject::sender() */);
+    bool ok = false;
+    uint32_t reg_id = bits_table ? bits_table->property("journal_id").toUInt(&ok) : 0;
+
+    if (!ok || reg_id >= this->m_journal_tables.size() || bits_table != this->m_journal_tables[reg_id])
+        return;
+
+    const std::vector<RegField> &fields = bits_table->fields();
+
+    // A full value typed or pasted may change many fields, which are undone as one operation.
+    this->m_edit_journal.begin_group();
+    for (size_t i = 0; i < fields.size(); ++i)
+    {
+        this->m_edit_journal.record(reg_id, static_cast<uint16_t>(i),
+            fields[i].extract(old_value), fields[i].extract(new_value));
     }
+    this->m_edit_journal.end_group();
 
-    QJsonParseError err;
-    QJsonDocument &doc = this->json();
+    this->update_undo_buttons();
+}
+
+void RegPanel::autosave_session(void)
+{
+    if (!this->m_started) // nothing to save but would overwrite the previous session
+        return;
+
+    // Captured in the GUI thread, and serialized and written in background.
+    this->m_session_autosaver.submit(this->capture_session());
+}
+
+static size_t estimate_table_bytes(const QTableWidget *outer_table)
+{
+    const auto *bits_table = dynamic_cast<const RegBitsTable *>(outer_table->cellWidget(2, 0));
+
+    return (bits_table->rowCount() + 2) * ESTIMATED_BYTES_PER_TABLE_ROW; // plus title and full values
+}
 
-    doc = QJsonDocument::fromJson(file.readAll(), &err);
+void RegPanel::prebuild_register_tables(void)
+{
+    QWidget *scroll_widget = this->vlayoutRegTables->parentWidget();
+    int count = 0;
 
-    if (QJsonParseError::NoError != err.error)
+    while (!this->m_prebuild_queue.empty() && count < PREBUILT_TABLES_PER_TICK)
     {
-        this->error_box("JSON Error", err.errorString());
+        if (this->m_table_pool.size() >= MAX_POOLED_REG_TABLES || this->m_pooled_bytes >= this->m_prebuild_cap)
+        {
+            qtCDebugV(::, "Pool is full, %lu table(s) left unbuilt.", this->m_prebuild_queue.size());
+            this->m_prebuild_queue.clear();
+            break;
+        }
 
-        return false;
+        const auto &layout = this->m_prebuild_queue.front();
+        // Titles and values are set on being reused.
+        QTableWidget *outer_table = this->build_register_table(scroll_widget, layout.first,
+            "pooled", QString(), layout.second, 0, 0);
+
+        outer_table->hide();
+        outer_table->setObjectName("pooled_holder");
+        this->m_table_pool.insert({ layout.first, outer_table });
+        this->m_pooled_bytes += estimate_table_bytes(outer_table);
+        this->m_prebuild_queue.pop_front();
+        ++count;
+    }
+
+    if (this->m_prebuild_queue.empty())
+    {
+        this->m_prebuild_timer->stop();
+        qtCDebugV(::, "%lu register table(s) pooled, about %lu KiB.",
+            this->m_table_pool.size(), this->m_pooled_bytes >> 10);
     }
+}
 
-    const QJsonObject &obj = doc.object();
-    const QJsonValue &val = obj.value("__modules__");
+bool RegPanel::restore_session(const QString &path)
+{
+    RegSession session;
+    QString err_msg;
 
-    if (val.isNull() || val.isUndefined())
+    if (!this->m_started)
     {
-        this->error_box("Invalid Format", QString::asprintf("There's no __modules__ array, err: %d", val.type()));
+        this->m_pending_session = path;
 
-        return false;
+        return true;
     }
 
-    if (!val.isArray())
+    if (!QFile::exists(path))
+        return false;
+
+    if (load_reg_session(path, session, &err_msg) < 0)
     {
-        this->error_box("Invalid Format", "__modules__ is NOT an array!");
+        qtCWarnV(::, "%s", err_msg.toStdString().c_str());
 
         return false;
     }
 
-    const QJsonArray &arr = val.toArray();
+    // Each change cascades down to the next list, and loads the configuration file on changing the file.
+    this->lstVendor->setCurrentText(session.vendor);
+    this->lstChip->setCurrentText(session.chip);
+    this->lstFile->setCurrentText(session.file);
+    this->lstModule->setCurrentText(session.module);
 
-    if (arr.empty())
+    if (this->lstFile->currentText() != session.file || this->lstModule->currentText() != session.module)
     {
-        this->error_box("Invalid Format", "Empty __modules__ array!");
+        qtCWarnV(::, "Module of the previous session is not available any more: %s/%s/%s: %s",
+            session.vendor.toStdString().c_str(), session.chip.toStdString().c_str(),
+            session.file.toStdString().c_str(), session.module.toStdString().c_str());
 
         return false;
     }
 
-    for (const auto &m : arr)
-    {
-        if (!m.isString())
-        {
-            this->error_box("Invalid Format", "__modules__ is NOT a pure string-array!");
+    this->lstDelimeter->setCurrentIndex(session.delim_index);
+    this->lstAddrBaseMethod->setCurrentText(session.addr_base_method);
+    this->spnboxAddrBase->setValue(session.addr_base);
+    this->chkboxAsInput->setChecked(session.as_input);
+    this->txtInput->setPlainText(session.input_text);
 
-            return false;
-        }
+    if (session.items.empty()) // tables are made as usual on switching to the view page
+        return true;
 
-        const QString &module_name = m.toString();
+    this->update_reg_addr_map(session.module);
+    this->clear_register_tables();
 
-        if (!obj.contains(module_name))
-        {
-            this->error_box("Invalid Format", QString("Cannot find module: ") + module_name);
+    int count = this->make_register_tables(session.items);
+    int scroll_pos = session.scroll_pos;
 
-            return false;
-        }
+    this->update_view_title(count);
 
-        if (!obj.value(module_name).isObject())
-        {
-            this->error_box("Invalid Format", QString("Module[") + module_name + "] is NOT a dictionary!");
+    // Marked as shown, so that switching to the view page won't make tables of the whole module again.
+    this->m_prev_vendor_idx = this->lstVendor->currentIndex();
+    this->m_prev_chip_idx = this->lstChip->currentIndex();
+    this->m_prev_file_idx = this->lstFile->currentIndex();
+    this->m_prev_module_idx = this->lstModule->currentIndex();
+    this->tab->setCurrentIndex(session.tab_index);
 
-            return false;
-        }
-    }
+    // The range of scroll bar is unknown until tables are laid out.
+    QTimer::singleShot(0, this, [this, scroll_pos]() {
+        this->scrollArea->verticalScrollBar()->setValue(scroll_pos);
+    });
+
+    qtCDebugV(::, "Restored %d register table(s) from session: %s", count, path.toStdString().c_str());
 
     return true;
 }
 
-static QLineEdit* make_register_title(QWidget *parent, const QString &table_prefix, const QString &title_text)
+void RegPanel::enable_session_autosave(const QString &path)
 {
-    auto *reg_title = new QLineEdit(title_text, parent);
-    QFont title_font;
-
-    reg_title->setObjectName(table_prefix + "_title");
-    //reg_title->setStyleSheet("background: transparent; border: none; color: #ffa348;");
-    reg_title->setStyleSheet("background: transparent; border: none; color: orange;");
-    title_font.setBold(true);
-    title_font.setPointSize(22);
-    reg_title->setFont(title_font);
-    reg_title->setReadOnly(true);
+    if (nullptr == this->m_autosave_timer)
+    {
+        this->m_autosave_timer = new QTimer(this);
+        this->connect(this->m_autosave_timer, SIGNAL(timeout()), this, SLOT(autosave_session()));
+    }
 
-    return reg_title;
+    this->m_session_autosaver.start(path);
+    this->m_autosave_timer->start(SESSION_AUTOSAVE_INTERVAL_MS);
 }
 
-QTableWidget* RegPanel::make_register_table(QWidget *parent, const QString &name_prefix,
-    const QString &dict_key, const QJsonArray &dict_value,
-    uint64_t default_value, uint64_t current_value)
+void RegPanel::set_prefetch_cap(size_t bytes)
 {
-    auto *outer_table = new QTableWidget(4, 1, parent);
-    auto *title_row = make_register_title(outer_table, name_prefix, dict_key);
-    auto *full_values_row = new RegFullValuesRow(outer_table, name_prefix, default_value, current_value);
-    auto *bits_table = new RegBitsTable(outer_table, name_prefix,
-        dict_key.toStdString().c_str(), dict_value, default_value, current_value);
-
-    outer_table->setRowHeight(0, title_row->height());
-    outer_table->setCellWidget(0, 0, title_row);
-    //outer_table->item(0, 0)->setTextAlignment(Qt::AlignHCenter | Qt::AlignVCenter);
-
-    outer_table->setRowHeight(1, resize_table_height(full_values_row, /* header_row_visible = */false));
-    outer_table->setCellWidget(1, 0, full_values_row);
-
-#if 0 // doesn't work
-    resize_table_height(bits_table, /* header_row_visible = */true);
-    outer_table->resizeRowToContents(2);
-#else
-    outer_table->setRowHeight(2, resize_table_height(bits_table, /* header_row_visible = */true));
-#endif
-    outer_table->setCellWidget(2, 0, bits_table);
-
-    outer_table->setObjectName(name_prefix + "_holder");
-    outer_table->setShowGrid(false);
-    outer_table->verticalHeader()->setVisible(false);
-    outer_table->horizontalHeader()->setVisible(false);
-    outer_table->horizontalHeader()->setStretchLastSection(true); // Auto-stretch for the final columns
-    resize_table_height(outer_table, /* header_row_visible = */false);
-
-    return outer_table;
+    this->m_prefetcher.set_memory_cap(bytes / 2);
+    this->m_prebuild_cap = bytes / 2;
 }
 
-static QString find_referenced_register_if_any(const QJsonObject &modules_dict,
-    const QString &orig_key, const QJsonArray &orig_value)
+RegSession RegPanel::capture_session(void) const
 {
-    for (const QJsonValue &item : orig_value)
+    QVBoxLayout *vlayout = this->vlayoutRegTables;
+    RegSession session;
+
+    session.vendor = this->lstVendor->currentText();
+    session.chip = this->lstChip->currentText();
+    session.file = this->lstFile->currentText();
+    session.module = this->lstModule->currentText();
+    session.tab_index = this->tab->currentIndex();
+    session.as_input = this->chkboxAsInput->isChecked();
+    session.delim_index = this->lstDelimeter->currentIndex();
+    session.addr_base_method = this->lstAddrBaseMethod->currentText();
+    session.addr_base = this->spnboxAddrBase->value();
+    session.input_text = this->txtInput->toPlainText();
+    session.scroll_pos = this->scrollArea->verticalScrollBar()->value();
+
+    // Tables shown belong to another module if the selection has changed since they were made.
+    if (this->lstVendor->currentIndex() != this->m_prev_vendor_idx
+        || this->lstChip->currentIndex() != this->m_prev_chip_idx
+        || this->lstFile->currentIndex() != this->m_prev_file_idx
+        || this->lstModule->currentIndex() != this->m_prev_module_idx)
     {
-        if (!item.isObject())
-            continue;
+        return session;
+    }
 
-        const QJsonObject &dict = item.toObject();
+    // In the order of layout rather than that of children, which differs for pooled tables.
+    for (int i = 0; i < vlayout->count(); ++i)
+    {
+        auto *outer_table = dynamic_cast<QTableWidget *>(vlayout->itemAt(i)->widget());
 
-        if (!dict.contains("ref"))
+        if (nullptr == outer_table)
             continue;
 
-        const QJsonValue &ref_val = dict.value("ref");
+        const QString &module_name = outer_table->property("module_name").toString();
 
-        if (!ref_val.isString())
+        if (module_name.isEmpty()) // of another file via the SoC map
             continue;
 
-        QString ref_key(ref_val.toString());
+        auto *title_cell = dynamic_cast<QLineEdit *>(outer_table->cellWidget(0, 0));
+        auto *full_values_cell = dynamic_cast<RegFullValuesRow *>(outer_table->cellWidget(1, 0));
 
-        return modules_dict.contains(ref_key) ? ref_key : QString("");
+        session.items.push_back({ module_name, title_cell->text(),
+            outer_table->property("module_base").toULongLong(), full_values_cell->current_value() });
     }
 
-    return QString("");
+    return session;
 }
 
-static uint64_t get_default_value(const QJsonObject &modules_dict, const QString &key)
+void RegPanel::finish_startup(std::shared_ptr<StartupResult> result)
 {
-    if (!modules_dict.contains("__defaults__"))
-        return 0;
+    if (this->m_startup_loader.joinable())
+        this->m_startup_loader.join();
 
-    const QJsonValue &def = modules_dict.value("__defaults__");
+    if (!result->err_msg.isEmpty())
+    {
+        this->error_box("Directory Error", result->err_msg);
 
-    if (!def.isObject())
-        return 0;
+        ABORT(EXIT_FAILURE);
+    }
 
-    const QJsonObject &def_dict = def.toObject();
+    this->m_vendors = std::move(result->vendors);
+    if (result->first_config)
+    {
+        this->m_prefetcher.put(result->first_config->path, result->first_config->json,
+            std::move(result->first_config->config), result->first_config->stamps);
+    }
 
-    if (!def_dict.contains(key))
-        return 0;
+    std::vector<std::string> config_files;
+
+    for (const auto &vendor : this->vendors())
+    {
+        for (const auto &chip : vendor.second)
+        {
+            for (const auto &file : chip.second)
+            {
+                config_files.push_back(vendor.first + "/" + chip.first + "/" + file);
+            }
+        }
+    }
+    this->m_search_index.build_async(this->m_config_dir, config_files);
+
+    emit this->lstVendor->currentIndexChanged(-1); // takes the preloaded file
+    emit this->lstAddrBaseMethod->currentIndexChanged(this->lstAddrBaseMethod->currentIndex());
+    emit this->chkboxAsInput->stateChanged(this->chkboxAsInput->isChecked());
 
-    const QJsonValue &def_val = def_dict.value(key);
+    this->tab->setEnabled(true);
+    this->m_started = true;
 
-    return def_val.isString() ? strtoull(def_val.toString().toStdString().c_str(), nullptr, 16) : 0;
+    if (!this->m_pending_session.isEmpty())
+    {
+        this->restore_session(this->m_pending_session);
+        this->m_pending_session.clear();
+    }
 }
 
-int RegPanel::make_register_tables(const QJsonDocument &json, const QString &module_name)
+QString RegPanel::config_file_path(const std::string &config_dir, const QString &vendor,
+    const QString &chip, const QString &file)
 {
-    const QJsonObject &modules_dict = json.object().value(module_name).toObject();
-    QVBoxLayout *vlayout = this->vlayoutRegTables;
-    QWidget *scroll_widget = vlayout->parentWidget();
-    int table_count = 0;
-    int i = 0;
+    return QString::fromStdString(config_dir) + QDir::separator() + vendor + QDir::separator()
+        + chip + QDir::separator() + file;
+}
 
-    for (QJsonObject::const_iterator iter = modules_dict.begin(); modules_dict.end() != iter; ++iter)
+// Entries of the mounted archive are sorted by path, thus grouped by vendor and then chip as well.
+static bool scan_config_archive(const RegConfigArchive &archive, std::vector<RegPanel::VendorItem> &vendor_items,
+    QString *err_msg)
+{
+    for (const auto &entry : archive.entries())
     {
-        const QString &orig_key = iter.key();
+        const QStringList &parts = entry.path.split('/');
 
-        ++i;
-
-        if (orig_key.startsWith("__"))
+        if (3 != parts.size())
             continue;
 
-        const QJsonValue &orig_value = iter.value();
+        const std::string &vendor = parts[0].toStdString();
+        const std::string &chip = parts[1].toStdString();
 
-        if (!orig_value.isArray())
-        {
-            qtCErrV(::, "[%d] Value of register[%s] is not an array!", i, orig_key.toStdString().c_str());
-            continue;
-        }
+        if (vendor_items.empty() || vendor_items.back().first != vendor)
+            vendor_items.push_back({ vendor, std::vector<RegPanel::ChipItem>() });
 
-        const QJsonArray &orig_val_arr = orig_value.toArray();
-        QString dest_key = find_referenced_register_if_any(modules_dict, orig_key, orig_val_arr);
-        QString name_prefix = QString::asprintf("reg[%d]", i);
-        uint64_t default_value = get_default_value(modules_dict, orig_key);
-        QTableWidget *reg_table;
+        auto &chips = vendor_items.back().second;
 
-        if (dest_key.isEmpty())
-        {
-            reg_table = this->make_register_table(scroll_widget, name_prefix, orig_key, orig_val_arr,
-                default_value, default_value);
-        }
-        else
-        {
-            qtCDebugV(::, "Redirecting reg[%s] to reg[%s] ...",
-                orig_key.toStdString().c_str(), dest_key.toStdString().c_str());
+        if (chips.empty() || chips.back().first != chip)
+            chips.push_back({ chip, std::vector<std::string>() });
 
-            const QJsonValue &dest_value = modules_dict.value(dest_key);
+        chips.back().second.push_back(parts[2].toStdString());
+    }
 
-            if (!dest_value.isArray())
-            {
-                qtCErrV(::, "[%d] Value of register[%s] is not an array!", i, dest_key.toStdString().c_str());
-                continue;
-            }
+    if (vendor_items.empty())
+    {
+        *err_msg = QString("No configuration files within archive:\n\n") + archive.path();
 
-            reg_table = this->make_register_table(scroll_widget, name_prefix, orig_key, dest_value.toArray(),
-                default_value, default_value);
-        }
+        return false;
+    }
 
-        vlayout->addWidget(reg_table, /* stretch = */0, Qt::AlignTop);
+    return true;
+}
 
-        if ((++table_count) < 2)
-        {
-            auto msg_handler = qInstallMessageHandler(nullptr); // Restore to the default one for auto-newline.
+bool RegPanel::scan_config_directory(const std::string &config_dir, std::vector<VendorItem> &vendor_items,
+    QString *err_msg)
+{
+    const RegConfigArchive *archive = mounted_reg_archive();
 
-            reg_table->dumpObjectTree();
-            qInstallMessageHandler(msg_handler); // Restore to the customized one.
+    if (archive && archive->path() == QString::fromStdString(config_dir))
+        return scan_config_archive(*archive, vendor_items, err_msg); // a single read of the index
+
+    QDir dir(QString::fromStdString(config_dir));
+
+    if (!dir.exists())
+    {
+        *err_msg = QString::asprintf("Non-existent or unreadable directory:\n\n%s", config_dir.c_str());
+
+        return false;
+    }
+
+    char dir_delim = QDir::separator().toLatin1();
+    auto dir_filters = QDir::Filter::Dirs | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
+    auto file_filters = QDir::Filter::Files | QDir::Filter::Readable | QDir::Filter::NoDotAndDotDot;
+    auto sort_flags = QDir::SortFlag::Name;
+    const auto &vendors = dir.entryList(dir_filters, sort_flags);
+
+    if (vendors.empty())
+    {
+        *err_msg = QString::asprintf("No readable vendor directories within:\n\n%s", config_dir.c_str());
+
+        return false;
+    }
+
+    vendor_items.reserve(vendors.count());
+    for (const auto &vendor_name : vendors)
+    {
+        auto v = vendor_items.insert(vendor_items.end(), { vendor_name.toStdString(), std::vector<ChipItem>() });
+        QDir vdir(QString::asprintf("%s%c%s", dir.path().toStdString().c_str(), dir_delim, v->first.c_str()));
+        const auto &chips = vdir.entryList(dir_filters, sort_flags);
+
+        if (chips.empty())
+            continue;
+
+        v->second.reserve(chips.count());
+        for (const auto &chip_name : chips)
+        {
+            auto c = v->second.insert(v->second.end(), { chip_name.toStdString(), std::vector<std::string>() });
+            QDir cdir(QString::asprintf("%s%c%s", vdir.path().toStdString().c_str(), dir_delim, c->first.c_str()));
+            const auto &files = cdir.entryList(file_filters, sort_flags);
+
+            if (files.empty())
+                continue;
+
+            c->second.reserve(files.count());
+            for (const auto &file_name : files)
+            {
+                c->second.push_back(file_name.toStdString());
+            }
         }
     }
 
-    return table_count;
+    return true;
 }
 
-#define IS_HEX_CHAR(c)          (((c) >= '0' && (c) <= '9') || ((c) >= 'A' && (c) <= 'F') || ((c) >= 'a' && (c) <= 'f'))
+bool RegPanel::load_config_file(const char *path)
+{
+    if (this->m_prefetcher.take(QString::fromUtf8(path), this->m_json, this->m_config))
+    {
+        qtCDebugV(::, "Prefetched file taken: %s", path);
 
-int RegPanel::make_register_tables(const QTextEdit &textbox, const QString &module_name)
+        return true;
+    }
+
+    QString err_msg;
+
+    // The kept document is the one with inheritance resolved, on which tables are made.
+    if (load_reg_config(QString::fromUtf8(path), this->m_config, &err_msg, &this->json()) < 0)
+    {
+        this->error_box("Invalid Format", err_msg);
+
+        return false;
+    }
+
+    return true;
+}
+
+void RegPanel::schedule_prefetch(int vendor_idx, int chip_idx, int file_idx)
 {
-    QVBoxLayout *vlayout = this->vlayoutRegTables;
-    QWidget *scroll_widget = vlayout->parentWidget();
-    int delim_index = this->lstDelimeter->currentIndex();
-    const char left_delim = (CURLY_BRACES == delim_index) ? '{' : '[';
-    const char right_delim = (CURLY_BRACES == delim_index) ? '}' : ']';
-    const QJsonObject &doc_dict = this->json().object();
-    const QJsonObject &modules_dict = doc_dict.value(module_name).toObject();
-    const QString &offset_method = this->lstAddrBaseMethod->currentText();
-    char offset_op = (0 == offset_method.compare("Ignore", Qt::CaseInsensitive)) ? '\0'
-        : ((0 == offset_method.compare("Add", Qt::CaseInsensitive)) ? '+' : '-');
-    uint64_t addr_offset = ('\0' == offset_op) ? 0 : this->spnboxAddrBase->value();
-    uint64_t addr = 0;
-    uint64_t value = 0;
-    const std::string &input = textbox.toPlainText().toStdString();
-    const char *ptr = input.c_str();
-    int table_seq = 1;
+    const VendorItem &vendor = this->vendors()[vendor_idx];
+    const ChipItem &chip = vendor.second[chip_idx];
+    const auto &files = chip.second;
+    std::vector<QString> paths;
 
-#define IS_DELIM_OR_NULL(c)     ((left_delim == (c)) || (right_delim == (c)) || ('\0' == (c)))
+    // Other files of the same chip are likely to be browsed next, the following ones first.
+    for (size_t i = 1; i < files.size(); ++i)
+    {
+        paths.push_back(config_file_path(this->config_dir(), QString::fromStdString(vendor.first),
+            QString::fromStdString(chip.first), QString::fromStdString(files[(file_idx + i) % files.size()])));
+    }
+    this->m_prefetcher.prefetch(paths);
 
-    while (true)
+    this->m_prebuild_queue.clear();
+    if (0 == this->m_prebuild_cap)
     {
-        if (left_delim != *ptr)
-            while (left_delim != *++ptr && '\0' != *ptr);
+        this->m_prebuild_timer->stop();
 
-        if ('\0' == *ptr) // Empty box, or the final array item.
-            break;
+        return;
+    }
+
+    /*
+     * Only one module is shown at a time, so each layout needs as many tables
+     * as the module using it the most, minus those pooled already.
+     */
+    const QJsonObject &doc_dict = this->json().object();
+    std::map<QString, std::pair<int, QJsonArray>> layouts; // key: compact JSON of bits items
+
+    for (const auto &m : doc_dict.value("__modules__").toArray())
+    {
+        const QJsonObject &modules_dict = doc_dict.value(m.toString()).toObject();
+        std::map<QString, int> counts;
 
-        if (left_delim != *ptr)
+        for (QJsonObject::const_iterator iter = modules_dict.begin(); modules_dict.end() != iter; ++iter)
         {
-            this->error_box("Invalid Format", QString::asprintf("No %c for item[%d]!\n\nConversion aborted!",
-                left_delim, table_seq));
-            break;
+            if (iter.key().startsWith("__") || !iter.value().isArray())
+                continue;
+
+            QString dest_key = find_referenced_register_if_any(modules_dict, iter.key(), iter.value().toArray());
+            const QJsonValue &dest_value = dest_key.isEmpty() ? iter.value() : modules_dict.value(dest_key);
+
+            if (!dest_value.isArray())
+                continue;
+
+            const QJsonArray &bits_items = dest_value.toArray();
+            const QString &layout_key = QString::fromUtf8(QJsonDocument(bits_items).toJson(QJsonDocument::Compact));
+            auto &layout = layouts[layout_key];
+            int count = ++counts[layout_key];
+
+            if (count > layout.first)
+            {
+                layout.first = count;
+                layout.second = bits_items;
+            }
+        }
+    }
+
+    for (const auto &layout : layouts)
+    {
+        for (int i = static_cast<int>(this->m_table_pool.count(layout.first)); i < layout.second.first; ++i)
+        {
+            this->m_prebuild_queue.push_back({ layout.first, layout.second.second });
         }
+    }
+
+    if (!this->m_prebuild_queue.empty())
+        this->m_prebuild_timer->start();
+}
 
-        char c;
+bool RegPanel::prepare_soc_map(void)
+{
+    int vendor_idx = this->lstVendor->currentIndex();
+    int chip_idx = this->lstChip->currentIndex();
+
+    if (vendor_idx < 0 || chip_idx < 0)
+        return false;
+
+    const ChipItem &chip = this->vendors()[vendor_idx].second[chip_idx];
+    QString chip_dir = QString::fromStdString(this->config_dir()) + QDir::separator()
+        + this->lstVendor->currentText() + QDir::separator() + this->lstChip->currentText();
+
+    // Built once per chip even if no module has a base, instead of on every conversion.
+    if (chip_dir.toStdString() != this->m_soc_map.chip_dir())
+    {
+        int count = this->m_soc_map.build(chip_dir.toStdString(), chip.second);
+
+        qtCDebugV(::, "Placed %d module(s) of chip[%s] into SoC map.", count, chip.first.c_str());
+    }
+
+    if (this->m_soc_map.empty())
+    {
+        this->error_box("Global Address Map", QString::asprintf("No module of chip[%s] has a __base__ property,"
+            " the global address map is unavailable!", chip.first.c_str()));
 
-        do
+        return false;
+    }
+
+    return true;
+}
+
+void RegPanel::update_reg_addr_map(const QString &module_name)
+{
+    const QJsonObject &modules_dict = this->json().object().value(module_name).toObject();
+
+    this->m_reg_addr_map.clear();
+    for (const QString &k : modules_dict.keys())
+    {
+        const std::string &key = k.toStdString();
+
+        if (!k.startsWith("__"))
+            this->m_reg_addr_map[strtoull(key.c_str(), nullptr, 16)] = key;
+    }
+}
+
+static QLineEdit* make_register_title(QWidget *parent, const QString &table_prefix, const QString &title_text)
+{
+    auto *reg_title = new QLineEdit(title_text, parent);
+
+    reg_title->setObjectName(table_prefix + "_title");
+    reg_title->setProperty("role", "title"); // styled by reg_tables_style_sheet()
+    reg_title->setFont(register_title_font());
+    reg_title->setReadOnly(true);
+
+    return reg_title;
+}
+
+bool RegPanel::load_field_annotations(const QString &path)
+{
+    QFile file(path);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        this->error_box("File Error", "Failed to read file:\n\n" + path + "\n\nReason:\n\n" + file.errorString());
+
+        return false;
+    }
+
+    QJsonParseError err;
+    const QJsonDocument &doc = QJsonDocument::fromJson(file.readAll(), &err);
+
+    if (QJsonParseError::NoError != err.error || !doc.object().value("fields").isArray())
+    {
+        this->error_box("Annotation Error", (QJsonParseError::NoError != err.error) ? err.errorString()
+            : "Not a report of stats biz:\n\n" + path);
+
+        return false;
+    }
+
+    const QJsonArray &fields = doc.object().value("fields").toArray();
+
+    this->m_field_notes.clear();
+    for (const auto &field_value : fields)
+    {
+        const QJsonObject &field = field_value.toObject();
+        const QJsonArray &values = field.value("values").toArray();
+        QStringList flags;
+        QString note;
+
+        for (const auto &flag : field.value("flags").toArray())
         {
-            c = *++ptr;
+            flags << flag.toString();
+        }
+        if (flags.isEmpty())
+            continue;
 
-            if (IS_HEX_CHAR(c) || IS_DELIM_OR_NULL(c))
-                break;
+        note = QString("[%1] default = %2, majority = %3, over %4 dump(s):").arg(flags.join(", "))
+            .arg(field.value("default").toString()).arg(field.value("majority").toString())
+            .arg(field.value("total").toInt());
+        for (const auto &value_item : values)
+        {
+            const QJsonObject &value = value_item.toObject();
+            const QString &label = value.value("label").toString();
+            const QJsonArray &dumps = value.value("dumps").toArray();
+
+            note += QString("\n  %1%2: %3").arg(value.value("value").toString())
+                .arg(label.isEmpty() ? QString() : " (" + label + ")").arg(value.value("count").toInt());
+            if (!dumps.isEmpty())
+                note += ", e.g.: " + dumps.first().toString();
         }
-        while (true);
 
-        if (IS_DELIM_OR_NULL(c))
+        this->m_field_notes[field.value("module").toString() + '\n' + field.value("register").toString() + '\n'
+            + field.value("bits").toString()] = note;
+    }
+
+    qtCDebugV(::, "Loaded %lu field annotation(s) from %s", this->m_field_notes.size(), path.toStdString().c_str());
+
+    return true;
+}
+
+void RegPanel::annotate_register_table(QTableWidget *reg_table, const QString &module_name, const QString &reg_key)
+{
+    auto *bits_table = dynamic_cast<RegBitsTable *>(reg_table->cellWidget(2, 0));
+    const QString &key_prefix = module_name + '\n' + reg_key + '\n';
+
+    for (auto iter = this->m_field_notes.lower_bound(key_prefix);
+        this->m_field_notes.end() != iter && iter->first.startsWith(key_prefix); ++iter)
+    {
+        bits_table->annotate(iter->first.mid(key_prefix.length()), iter->second);
+    }
+}
+
+void RegPanel::flag_register_issue(QTableWidget *reg_table, const RegIssue &issue)
+{
+    const QString &text = reg_issue_text(issue);
+
+    qtCWarnV(::, "%s: %s", issue.reg->key.toStdString().c_str(), text.toStdString().c_str());
+
+    if (issue.field)
+    {
+        dynamic_cast<RegBitsTable *>(reg_table->cellWidget(2, 0))->annotate(issue.field->range, text);
+
+        return;
+    }
+
+    auto *title_cell = dynamic_cast<QLineEdit *>(reg_table->cellWidget(0, 0));
+
+    set_style_property(title_cell, "flagged", true);
+    title_cell->setToolTip(title_cell->toolTip().isEmpty() ? text : (title_cell->toolTip() + "\n" + text));
+}
+
+void RegPanel::track_register_edits(QTableWidget *reg_table)
+{
+    auto *bits_table = dynamic_cast<RegBitsTable *>(reg_table->cellWidget(2, 0));
+
+    bits_table->setProperty("journal_id", static_cast<uint>(this->m_journal_tables.size()));
+    this->m_journal_tables.push_back(bits_table);
+}
+
+// Deltas are applied field by field, so that only the affected rows are updated.
+void RegPanel::apply_register_edits(const std::vector<RegEditJournal::Entry> &deltas, bool is_redo)
+{
+    QWidget *scroll_widget = this->vlayoutRegTables->parentWidget();
+
+    scroll_widget->setUpdatesEnabled(false);
+    for (const auto &delta : deltas)
+    {
+        if (delta.reg_id < this->m_journal_tables.size())
         {
-            this->error_box("Invalid Format", QString::asprintf("No address for item[%d]!\n\nConversion aborted!",
-                table_seq));
-            break;
+            this->m_journal_tables[delta.reg_id]->set_field(delta.field_index,
+                is_redo ? delta.new_bits : delta.old_bits);
         }
+    }
+    scroll_widget->setUpdatesEnabled(true);
 
-        char *end_ptr;
+    if (!deltas.empty() && deltas.front().reg_id < this->m_journal_tables.size())
+        this->scrollArea->ensureWidgetVisible(this->m_journal_tables[deltas.front().reg_id]);
+}
 
-        addr = strtoull(ptr, &end_ptr, 16);
-        if ('+' == offset_op)
-            addr += addr_offset;
-        else
-            addr -= addr_offset;
+void RegPanel::update_undo_buttons(void)
+{
+    this->btnUndo->setEnabled(this->m_edit_journal.can_undo());
+    this->btnRedo->setEnabled(this->m_edit_journal.can_redo());
+}
+
+QTableWidget* RegPanel::reuse_register_table(const QString &layout_key, const QString &name_prefix,
+    const QString &dict_key, uint64_t default_value, uint64_t current_value)
+{
+    auto iter = this->m_table_pool.find(layout_key);
+
+    if (this->m_table_pool.end() == iter)
+        return nullptr;
+
+    QTableWidget *outer_table = iter->second;
+    auto *title_cell = dynamic_cast<QLineEdit *>(outer_table->cellWidget(0, 0));
+    auto *full_values_row = dynamic_cast<RegFullValuesRow *>(outer_table->cellWidget(1, 0));
+    auto *bits_table = dynamic_cast<RegBitsTable *>(outer_table->cellWidget(2, 0));
+
+    this->m_table_pool.erase(iter);
+    this->m_pooled_bytes -= estimate_table_bytes(outer_table);
+
+    title_cell->setText(dict_key);
+    set_style_property(title_cell, "flagged", false);
+    title_cell->setToolTip("");
+    bits_table->rebind(default_value, current_value);
+    full_values_row->rebind(default_value, current_value);
+    // NOTE: Names of inner widgets are left as they were, since only the outer one is looked up.
+    outer_table->setObjectName(name_prefix + "_holder");
+    outer_table->show();
+
+    return outer_table;
+}
+
+QTableWidget* RegPanel::make_register_table(QWidget *parent, const QString &name_prefix,
+    const QString &dict_key, const QJsonArray &dict_value,
+    uint64_t default_value, uint64_t current_value)
+{
+    // Tables of the same bits items differ only in title and values, so a pooled one is reset and rebound if any.
+    const QString &layout_key = QString::fromUtf8(QJsonDocument(dict_value).toJson(QJsonDocument::Compact));
+    QTableWidget *outer_table = this->reuse_register_table(layout_key, name_prefix,
+        dict_key, default_value, current_value);
+
+    if (nullptr == outer_table)
+    {
+        outer_table = this->build_register_table(parent, layout_key,
+            name_prefix, dict_key, dict_value, default_value, current_value);
+    }
+    this->track_register_edits(outer_table);
+
+    return outer_table;
+}
+
+QTableWidget* RegPanel::build_register_table(QWidget *parent, const QString &layout_key,
+    const QString &name_prefix, const QString &dict_key, const QJsonArray &dict_value,
+    uint64_t default_value, uint64_t current_value)
+{
+    auto *outer_table = new QTableWidget(4, 1, parent);
+    auto *title_row = make_register_title(outer_table, name_prefix, dict_key);
+    auto *full_values_row = new RegFullValuesRow(outer_table, name_prefix, default_value, current_value);
+    auto *bits_table = new RegBitsTable(outer_table, name_prefix,
+        dict_key.toStdString().c_str(), dict_value, default_value, current_value);
+
+    QObject::connect(bits_table, &RegBitsTable::valueChanged, full_values_row, &RegFullValuesRow::sync);
+    QObject::connect(full_values_row->current_value_box(), SIGNAL(valueChanged(uint64_t)),
+        bits_table, SLOT(edit_value(uint64_t)));
+    QObject::connect(bits_table, &RegBitsTable::edited, this, &RegPanel::record_register_edit);
+
+    outer_table->setRowHeight(0, title_row->height());
+    outer_table->setCellWidget(0, 0, title_row);
+    //outer_table->item(0, 0)->setTextAlignment(Qt::AlignHCenter | Qt::AlignVCenter);
+
+    outer_table->setRowHeight(1, resize_table_height(full_values_row, /* header_row_visible = */false));
+    outer_table->setCellWidget(1, 0, full_values_row);
+
+#if 0 // doesn't work
+    resize_table_height(bits_table, /* header_row_visible = */true);
+    outer_table->resizeRowToContents(2);
+#else
+    outer_table->setRowHeight(2, resize_table_height(bits_table, /* header_row_visible = */true));
+#endif
+    outer_table->setCellWidget(2, 0, bits_table);
+
+    outer_table->setObjectName(name_prefix + "_holder");
+    outer_table->setProperty("layout_key", layout_key);
+    outer_table->setShowGrid(false);
+    outer_table->verticalHeader()->setVisible(false);
+    outer_table->horizontalHeader()->setVisible(false);
+    outer_table->horizontalHeader()->setStretchLastSection(true); // Auto-stretch for the final columns
+    resize_table_height(outer_table, /* header_row_visible = */false);
+
+    return outer_table;
+}
 
-        if (/*'\0' != *ptr && */'\0' == *end_ptr) // Entire string has been parsed.
+int RegPanel::make_register_tables(const QJsonDocument &json, const QString &module_name,
+    const QString &only_key/* = QString() */)
+{
+    const QJsonObject &modules_dict = json.object().value(module_name).toObject();
+    const RegModule *compiled_module = this->m_config.find_module(module_name);
+    // A register searched for is always shown.
+    bool filtering = only_key.isEmpty() && !this->m_view_filter.empty();
+    QVBoxLayout *vlayout = this->vlayoutRegTables;
+    QWidget *scroll_widget = vlayout->parentWidget();
+    uint64_t module_base = 0;
+    int table_count = 0;
+    int i = 0;
+
+    this->m_filtered_count = 0;
+
+    get_module_base(modules_dict, module_base);
+
+    for (QJsonObject::const_iterator iter = modules_dict.begin(); modules_dict.end() != iter; ++iter)
+    {
+        const QString &orig_key = iter.key();
+
+        ++i;
+
+        if (orig_key.startsWith("__") || (!only_key.isEmpty() && orig_key != only_key))
+            continue;
+
+        const QJsonValue &orig_value = iter.value();
+
+        if (!orig_value.isArray())
         {
-            this->error_box("Invalid Format", QString::asprintf("No value for item[%d]!\n\nConversion aborted!",
-                table_seq));
-            break;
+            qtCErrV(::, "[%d] Value of register[%s] is not an array!", i, orig_key.toStdString().c_str());
+            continue;
         }
 
-        ptr = end_ptr;
-        do
+        const QJsonArray &orig_val_arr = orig_value.toArray();
+        QString dest_key = find_referenced_register_if_any(modules_dict, orig_key, orig_val_arr);
+        QString name_prefix = QString::asprintf("reg[%d]", i);
+        uint64_t default_value = get_default_value(modules_dict, orig_key);
+        QTableWidget *reg_table;
+
+        if (filtering)
         {
-            c = *++ptr;
+            const RegInfo *compiled_reg = compiled_module ? compiled_module->find_register(orig_key) : nullptr;
 
-            if (IS_HEX_CHAR(c) || IS_DELIM_OR_NULL(c))
-                break;
+            if (!this->m_view_filter.accepts(compiled_reg, orig_key, default_value, default_value,
+                /* flagged = */false))
+            {
+                ++this->m_filtered_count;
+                continue;
+            }
         }
-        while (true);
 
-        if (IS_DELIM_OR_NULL(c))
+        if (dest_key.isEmpty())
         {
-            this->error_box("Invalid Format", QString::asprintf("No value for item[%d]!\n\nConversion aborted!",
-                table_seq));
-            break;
+            reg_table = this->make_register_table(scroll_widget, name_prefix, orig_key, orig_val_arr,
+                default_value, default_value);
+        }
+        else
+        {
+            qtCDebugV(::, "Redirecting reg[%s] to reg[%s] ...",
+                orig_key.toStdString().c_str(), dest_key.toStdString().c_str());
+
+            const QJsonValue &dest_value = modules_dict.value(dest_key);
+
+            if (!dest_value.isArray())
+            {
+                qtCErrV(::, "[%d] Value of register[%s] is not an array!", i, dest_key.toStdString().c_str());
+                continue;
+            }
+
+            reg_table = this->make_register_table(scroll_widget, name_prefix, orig_key, dest_value.toArray(),
+                default_value, default_value);
         }
 
-        value = strtoull(ptr, &end_ptr, 16);
+        this->annotate_register_table(reg_table, module_name, orig_key);
+        reg_table->setProperty("module_name", module_name);
+        reg_table->setProperty("module_base", QVariant::fromValue<qulonglong>(module_base));
+        vlayout->addWidget(reg_table, /* stretch = */0, Qt::AlignTop);
 
-        ptr = end_ptr;
-        do
+        if ((++table_count) < 2)
         {
-            c = *ptr++;
+            auto msg_handler = qInstallMessageHandler(nullptr); // Restore to the default one for auto-newline.
 
-            if ((right_delim == c) || (left_delim == c) || ('\0' == c))
-                break;
+            reg_table->dumpObjectTree();
+            qInstallMessageHandler(msg_handler); // Restore to the customized one.
         }
-        while (true);
+    }
+
+    return table_count;
+}
+
+int RegPanel::make_register_tables(const QTextEdit &textbox, const QString &module_name)
+{
+    QVBoxLayout *vlayout = this->vlayoutRegTables;
+    QWidget *scroll_widget = vlayout->parentWidget();
+    int delim_index = this->lstDelimeter->currentIndex();
+    const QJsonObject &doc_dict = this->json().object();
+    const QJsonObject &modules_dict = doc_dict.value(module_name).toObject();
+    const QString &offset_method = this->lstAddrBaseMethod->currentText();
+    bool is_global = (0 == offset_method.compare("Global", Qt::CaseInsensitive));
+    char offset_op = (is_global || 0 == offset_method.compare("Ignore", Qt::CaseInsensitive)) ? '\0'
+        : ((0 == offset_method.compare("Add", Qt::CaseInsensitive)) ? '+' : '-');
+    uint64_t addr_offset = ('\0' == offset_op) ? 0 : this->spnboxAddrBase->value();
+    uint64_t addr = 0;
+    uint64_t value = 0;
+    const std::string &input = textbox.toPlainText().toStdString();
+    std::vector<RegArrayItem> items;
+    QString err_msg;
+    int table_seq = 1;
+
+    if (is_global && !this->prepare_soc_map())
+        return 0;
+
+    if (parse_register_array_items(input.c_str(), delim_index, items, &err_msg) < 0)
+        this->error_box("Invalid Format", err_msg + "\n\nConversion aborted!");
+
+    RegDecoder decoder(this->m_config, module_name, parse_addr_base_method(offset_method), addr_offset);
+    std::vector<RegIssue> issues;
+    size_t issue_pos = 0;
+    bool filtering = !this->m_view_filter.empty();
+
+    this->m_filtered_count = 0;
+
+    if (validate_register_items(decoder, items, issues) > 0)
+        qtCWarnV(::, "%lu issue(s) found in %lu register value(s).", issues.size(), items.size());
+
+    for (size_t item_index = 0; item_index < items.size(); ++item_index)
+    {
+        const RegArrayItem &item = items[item_index];
 
-        if (right_delim != c)
+        addr = item.addr;
+        if ('+' == offset_op)
+            addr += addr_offset;
+        else
+            addr -= addr_offset;
+
+        value = item.value;
+
+        const SocAddrMap::Module *soc_module = nullptr;
+        const std::string *orig_key_str = nullptr;
+        QString orig_key;
+
+        if (is_global)
+            orig_key_str = this->m_soc_map.find_register(addr, &soc_module);
+        else
         {
-            this->error_box("Invalid Format", QString::asprintf("No %c for item[%d]!\n\nConversion aborted!",
-                right_delim, table_seq));
-            break;
+            auto orig_key_iter = this->m_reg_addr_map.find(addr);
+
+            if (this->m_reg_addr_map.end() != orig_key_iter)
+                orig_key_str = &orig_key_iter->second;
         }
 
-        auto orig_key_iter = this->m_reg_addr_map.find(addr);
+        if (orig_key_str)
+            orig_key = QString::fromStdString(*orig_key_str);
+        else if (!is_global)
+        {
+            const RegModule *abs_module = nullptr;
+            // Absolute addresses of the selected module are resolved as they are, the same as in validation.
+            const RegInfo *abs_reg = decoder.find_register(item.addr, &abs_module);
+
+            if (abs_reg)
+                orig_key = abs_reg->key;
+        }
+        else
+        {
+            ; // nothing but for the sake of Code of Conduct
+        }
 
-        if (this->m_reg_addr_map.end() == orig_key_iter)
+        if (orig_key.isEmpty())
         {
             qtCErrV(::, "[%d] No such a register with address = 0x%lx", table_seq, addr);
             continue;
         }
 
-        QString orig_key = QString::fromStdString(orig_key_iter->second);
-        const QJsonValue &orig_value = modules_dict.value(orig_key);
+        const QJsonObject &reg_modules_dict = soc_module ? soc_module->dict : modules_dict;
+        const QJsonValue &orig_value = reg_modules_dict.value(orig_key);
 
         if (!orig_value.isArray())
         {
@@ -769,11 +1431,32 @@ int RegPanel::make_register_tables(const QTextEdit &textbox, const QString &modu
         }
 
         const QJsonArray &orig_val_arr = orig_value.toArray();
-        QString dest_key = find_referenced_register_if_any(modules_dict, orig_key, orig_val_arr);
+        QString dest_key = find_referenced_register_if_any(reg_modules_dict, orig_key, orig_val_arr);
         QString name_prefix = QString::asprintf("reg[%d]", table_seq);
-        uint64_t default_value = get_default_value(modules_dict, orig_key);
+        uint64_t default_value = get_default_value(reg_modules_dict, orig_key);
         QTableWidget *reg_table;
 
+        for (; issue_pos < issues.size() && issues[issue_pos].item_index < item_index; ++issue_pos)
+        {
+            ; // Skips issues of items not shown.
+        }
+
+        if (filtering)
+        {
+            const RegModule *compiled_module = nullptr;
+            const RegInfo *compiled_reg = decoder.find_register(item.addr, &compiled_module);
+            bool flagged = (issue_pos < issues.size() && issues[issue_pos].item_index == item_index);
+
+            if (compiled_reg && compiled_reg->key != orig_key) // resolved differently via the SoC map
+                compiled_reg = nullptr;
+
+            if (!this->m_view_filter.accepts(compiled_reg, orig_key, default_value, value, flagged))
+            {
+                ++this->m_filtered_count;
+                continue;
+            }
+        }
+
         if (dest_key.isEmpty())
         {
             reg_table = this->make_register_table(scroll_widget, name_prefix, orig_key, orig_val_arr,
@@ -781,7 +1464,7 @@ int RegPanel::make_register_tables(const QTextEdit &textbox, const QString &modu
         }
         else
         {
-            const QJsonValue &dest_value = modules_dict.value(dest_key);
+            const QJsonValue &dest_value = reg_modules_dict.value(dest_key);
 
             if (!dest_value.isArray())
             {
@@ -793,12 +1476,29 @@ int RegPanel::make_register_tables(const QTextEdit &textbox, const QString &modu
                 default_value, value);
         }
 
+        if (soc_module)
+        {
+            auto *title_cell = dynamic_cast<QLineEdit *>(reg_table->cellWidget(0, 0));
+
+            title_cell->setToolTip(QString::asprintf("%s: %s @ 0x%lx", soc_module->file.c_str(),
+                soc_module->name.toStdString().c_str(), addr));
+        }
+        this->annotate_register_table(reg_table, soc_module ? soc_module->name : module_name, orig_key);
+        for (; issue_pos < issues.size() && issues[issue_pos].item_index <= item_index; ++issue_pos)
+        {
+            if (issues[issue_pos].item_index == item_index)
+                this->flag_register_issue(reg_table, issues[issue_pos]);
+        }
+        // Registers of other files found via the SoC map are not saved in sessions.
+        reg_table->setProperty("module_name", (nullptr == soc_module) ? module_name
+            : ((soc_module->file == this->lstFile->currentText().toStdString()) ? soc_module->name : QString()));
+        reg_table->setProperty("module_base", QVariant::fromValue<qulonglong>(soc_module ? soc_module->base : 0));
         vlayout->addWidget(reg_table, /* stretch = */0, Qt::AlignTop);
 
         ++table_seq;
-    } // while (true)
+    } // for (item : items)
 
-    if (table_seq <= 1)
+    if (table_seq <= 1 && 0 == this->m_filtered_count)
     {
         if (input.size() > 0)
             this->error_box("Conversion Error", "Select the correct delimiter type, "
@@ -810,6 +1510,79 @@ int RegPanel::make_register_tables(const QTextEdit &textbox, const QString &modu
     return table_seq - 1;
 }
 
+// Values are applied directly, without going through the text converter.
+int RegPanel::make_register_tables(const std::vector<RegSessionItem> &items)
+{
+    QVBoxLayout *vlayout = this->vlayoutRegTables;
+    QWidget *scroll_widget = vlayout->parentWidget();
+    const QJsonObject &doc_dict = this->json().object();
+    int table_seq = 1;
+
+    this->m_filtered_count = 0;
+
+    for (const auto &item : items)
+    {
+        const QJsonObject &modules_dict = doc_dict.value(item.module).toObject();
+        const QJsonValue &orig_value = modules_dict.value(item.reg_key);
+
+        if (!orig_value.isArray())
+        {
+            qtCErrV(::, "[%d] No such a register: %s: %s", table_seq,
+                item.module.toStdString().c_str(), item.reg_key.toStdString().c_str());
+            continue;
+        }
+
+        QString dest_key = find_referenced_register_if_any(modules_dict, item.reg_key, orig_value.toArray());
+        const QJsonValue &dest_value = dest_key.isEmpty() ? orig_value : modules_dict.value(dest_key);
+
+        if (!dest_value.isArray())
+        {
+            qtCErrV(::, "[%d] Value of register[%s] is not an array!", table_seq, dest_key.toStdString().c_str());
+            continue;
+        }
+
+        QTableWidget *reg_table = this->make_register_table(scroll_widget, QString::asprintf("reg[%d]", table_seq),
+            item.reg_key, dest_value.toArray(), get_default_value(modules_dict, item.reg_key), item.value);
+
+        this->annotate_register_table(reg_table, item.module, item.reg_key);
+        reg_table->setProperty("module_name", item.module);
+        reg_table->setProperty("module_base", QVariant::fromValue<qulonglong>(item.module_base));
+        vlayout->addWidget(reg_table, /* stretch = */0, Qt::AlignTop);
+
+        ++table_seq;
+    }
+
+    return table_seq - 1;
+}
+
+static void destroy_register_table(QTableWidget *outer_table, bool verbose)
+{
+    auto *title_cell = dynamic_cast<QLineEdit *>(outer_table->cellWidget(0, 0));
+    auto *full_values_cell = dynamic_cast<RegFullValuesRow *>(outer_table->cellWidget(1, 0));
+    auto *bits_table_cell = dynamic_cast<RegBitsTable *>(outer_table->cellWidget(2, 0));
+
+    qtCDebugV(::, "\tDeleting: %s (%s)", title_cell->objectName().toStdString().c_str(),
+        title_cell->text().toStdString().c_str());
+    delete title_cell;
+
+    if (verbose) qtCDebugV(::, "\tDeleting: %s", full_values_cell->objectName().toStdString().c_str());
+    delete full_values_cell;
+
+    if (verbose) qtCDebugV(::, "\tDeleting: %s", bits_table_cell->objectName().toStdString().c_str());
+    delete bits_table_cell;
+
+    qtCDebugV(::, "Deleting: %s", outer_table->objectName().toStdString().c_str());
+    //outer_table->clear();
+    //outer_table->setRowCount(0);
+    delete outer_table;
+}
+
+/*
+ * Register tables are detached from the layout, hidden and pooled by their bits items
+ * rather than destroyed, so that converting dumps of the same module again and again
+ * only resets and rebinds them. Pooled tables are renamed so as not to be taken
+ * as visible ones by generate_register_array_items().
+ */
 void RegPanel::clear_register_tables(void)
 {
     QVBoxLayout *vlayout = this->vlayoutRegTables;
@@ -819,6 +1592,13 @@ void RegPanel::clear_register_tables(void)
         return (0 == widget_name.compare(0, 4, "reg["));
     };
 
+    // Register ids of the journal make no sense any more.
+    this->m_edit_journal.clear();
+    this->m_journal_tables.clear();
+    this->update_undo_buttons();
+
+    scroll_widget->setUpdatesEnabled(false);
+
     for (auto &i : scroll_widget->children())
     {
         const std::string &iname = i->objectName().toStdString();
@@ -827,56 +1607,62 @@ void RegPanel::clear_register_tables(void)
             continue;
 
         auto *outer_table = dynamic_cast<QTableWidget *>(i);
-        auto *title_cell = dynamic_cast<QLineEdit *>(outer_table->cellWidget(0, 0));
-        auto *full_values_cell = dynamic_cast<RegFullValuesRow *>(outer_table->cellWidget(1, 0));
-        auto *bits_table_cell = dynamic_cast<RegBitsTable *>(outer_table->cellWidget(2, 0));
 
-        qtCDebugV(::, "\tDeleting: %s (%s)", title_cell->objectName().toStdString().c_str(),
-            title_cell->text().toStdString().c_str());
-        delete title_cell;
+        vlayout->removeWidget(outer_table);
 
-        if (print_flag) qtCDebugV(::, "\tDeleting: %s", full_values_cell->objectName().toStdString().c_str());
-        delete full_values_cell;
+        if (this->m_table_pool.size() >= MAX_POOLED_REG_TABLES)
+        {
+            destroy_register_table(outer_table, print_flag);
+            print_flag = false;
+            continue;
+        }
 
-        if (print_flag) qtCDebugV(::, "\tDeleting: %s", bits_table_cell->objectName().toStdString().c_str());
-        delete bits_table_cell;
+        outer_table->hide();
+        outer_table->setObjectName("pooled_holder");
+        this->m_table_pool.insert({ outer_table->property("layout_key").toString(), outer_table });
+        this->m_pooled_bytes += estimate_table_bytes(outer_table);
+    } // for (auto &i : scroll_widget->children())
 
-        qtCDebugV(::, "Deleting: %s", iname.c_str());
-        vlayout->removeWidget(outer_table);
-        //outer_table->clear();
-        //outer_table->setRowCount(0);
-        delete outer_table;
+    scroll_widget->setUpdatesEnabled(true);
 
-        print_flag = false;
-    } // for (auto &i : scroll_widget->children())
+    qtCDebugV(::, "%lu register table(s) pooled.", this->m_table_pool.size());
 }
 
-#define DEFAULT_BITWIDTH        32
-
-static inline int get_bitwidth(const QJsonObject &doc_dict, const QString &key)
+void RegPanel::refresh_register_tables(void)
 {
-    if (!doc_dict.contains(key))
-        return DEFAULT_BITWIDTH;
-
-    const QJsonValue &width_val = doc_dict.value(key);
-    int result = width_val.isDouble() ? width_val.toDouble()
-        : (width_val.isString() ? atoi(width_val.toString().toStdString().c_str()) : DEFAULT_BITWIDTH);
+    // Nothing is shown before switching to the view page at least once.
+    if (this->m_prev_module_idx < 0 || this->lstModule->currentIndex() < 0)
+        return;
 
-    return (8 == result || 16 == result || 32 == result || 64 == result) ? result : DEFAULT_BITWIDTH;
-}
+    const QString &module_name = this->lstModule->currentText();
+    int count;
 
-static inline const char* bitwidth_format_string(int bitwidth)
-{
-    if (8 == bitwidth)
-        return "0x%02lx";
+    if (this->chkboxAsInput->isChecked())
+    {
+        if (this->txtInput->toPlainText().trimmed().isEmpty())
+            return;
 
-    if (16 == bitwidth)
-        return "0x%04lx";
+        this->clear_register_tables();
+        count = this->make_register_tables(*this->txtInput, module_name);
+    }
+    else
+    {
+        this->clear_register_tables();
+        count = this->make_register_tables(this->json(), module_name);
+    }
 
-    if (64 == bitwidth)
-        return "0x%016lx";
+    this->update_view_title(count);
+}
 
-    return "0x%08lx";
+void RegPanel::update_view_title(int count)
+{
+    if (this->m_filtered_count > 0)
+    {
+        this->grpboxView->setTitle(QString::asprintf("View: %d item(s) below, %d filtered out",
+            (count >= 0) ? count : 0, this->m_filtered_count));
+    }
+    else
+        this->grpboxView->setTitle(QString::asprintf("View: %d item(s) below", (count >= 0) ? count : 0));
 }
 
 int RegPanel::generate_register_array_items(const QString &module_name, const QTextEdit &textbox)
@@ -884,15 +1670,11 @@ int RegPanel::generate_register_array_items(const QString &module_name, const QT
     QVBoxLayout *vlayout = this->vlayoutRegTables;
     QWidget *scroll_widget = vlayout->parentWidget();
     int delim_index = this->lstDelimeter->currentIndex();
-    const char left_delim = (CURLY_BRACES == delim_index) ? '{' : '[';
-    const char right_delim = (CURLY_BRACES == delim_index) ? '}' : ']';
     const QJsonObject &doc_dict = this->json().object();
     const char *addr_width_fmt = bitwidth_format_string(get_bitwidth(doc_dict, "__addr_bits__"));
     const char *value_width_fmt = bitwidth_format_string(get_bitwidth(doc_dict, "__data_bits__"));
-    const QString &offset_method = this->lstAddrBaseMethod->currentText();
-    char offset_op = (0 == offset_method.compare("Ignore", Qt::CaseInsensitive)) ? '\0'
-        : ((0 == offset_method.compare("Add", Qt::CaseInsensitive)) ? '+' : '-');
-    uint64_t addr_offset = ('\0' == offset_op) ? 0 : this->spnboxAddrBase->value();
+    AddrBaseMethod offset_method = parse_addr_base_method(this->lstAddrBaseMethod->currentText());
+    uint64_t addr_offset = this->spnboxAddrBase->value();
     uint64_t addr = 0;
     uint64_t value = 0;
     QString result;
@@ -912,17 +1694,11 @@ int RegPanel::generate_register_array_items(const QString &module_name, const QT
 
         addr = strtoull(title_cell->text().toStdString().c_str(), nullptr, 16);
         //addr = title_cell->text().toULongLong(nullptr, 16); // will fail due to the "0x" prefix.
-        if ('+' == offset_op)
-            addr += addr_offset;
-        else
-            addr -= addr_offset;
+        addr = apply_addr_base(addr, offset_method, addr_offset, outer_table->property("module_base").toULongLong());
 
         value = full_values_cell->current_value();
 
-        result.append(left_delim).append(' ')
-            .append(QString::asprintf(addr_width_fmt, addr)).append(", ")
-            .append(QString::asprintf(value_width_fmt, value))
-            .append(' ').append(right_delim).append(",\n");
+        append_register_array_item(result, delim_index, addr_width_fmt, value_width_fmt, addr, value);
 
         ++count;
     } // for (auto &i : scroll_widget->children())
@@ -977,5 +1753,44 @@ int RegPanel::generate_register_array_items(const QString &module_name, const QT
  *  01. Remove the trailing newline character from each log message.
  *  02. Remove module prefix of each Qt header files to improve robustness.
  *  03. Remove the unused QTextCodec variable.
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Add a "Global" address base method to decode physical addresses
+ *      via the SoC-level address map of the selected chip.
+ *  02. Support 64-bit address base, and look up absolute addresses
+ *      of the selected module via the module interval index.
+ *  03. Move the format checking and some helper functions into
+ *      reg_schema.cpp and reg_codec.cpp for sharing with the headless modes.
+ *  04. Move the parser of register array items into reg_codec.cpp.
+ *  05. Annotate fields flagged in the report of stats biz.
+ *  06. Validate register values against access masks and enum sets
+ *      on every conversion, and flag the offending fields.
+ *  07. Sync the full-values row via RegBitsTable::valueChanged().
+ *  08. Recycle register tables via a pool keyed by bits items,
+ *      instead of destroying and rebuilding them on every conversion.
+ *  09. Style widgets via dynamic properties and the application-level
+ *      style sheet instead of style sheets of their own.
+ *  10. Support searching registers across all configuration files via
+ *      an index built in background, and showing only the chosen one.
+ *  11. Add a view filter (changed from default, read-write only, flagged by
+ *      validation, and matching text) evaluated on compiled registers
+ *      before any table is made.
+ *  12. Support undoing and redoing edits of register values via a journal
+ *      of per-field deltas, in which a full value typed or pasted counts as one edit.
+ *  13. Save sessions as binary snapshots periodically in background and on exit,
+ *      and restore them on start without going through the text converter.
+ *  14. Show the window right away, and scan the configuration directory and
+ *      load the file selected by default in background.
+ *  15. Prefetch other files of the selected chip in background, and pre-build
+ *      register tables of all modules of the current file into the pool while idle,
+ *      both within a configurable memory cap.
+ *  16. Support scanning and loading configuration files from the mounted archive.
+ *  17. Load configuration files via load_reg_config() to support inheritance.
+ *  18. Build the SoC map once per chip even if it turns out empty, instead of
+ *      rebuilding it for every register not found in the selected module.
+ *  19. Leave the lookup of absolute addresses of the selected module to RegDecoder,
+ *      with addresses not rebased, so that validation and filtering resolve them as well.
+ *  20. Pass the stamps of the inheritance chain of the file loaded at startup to the prefetcher,
+ *      so that it's taken as stale once any of its base files is modified.
  */
 
@@ -19,11 +19,25 @@
 #ifndef __REGPANEL_HPP__
 #define __REGPANEL_HPP__
 
+#include <thread>
+#include <memory>
+#include <deque>
+
 #include <QJsonDocument>
+#include <QJsonArray>
 
 #include "ui_regpanel.h"
+#include "soc_map.hpp"
+#include "reg_validator.hpp"
+#include "reg_search.hpp"
+#include "reg_filter.hpp"
+#include "reg_journal.hpp"
+#include "reg_session.hpp"
+#include "reg_prefetch.hpp"
 
 class QTableWidget;
+class QTimer;
+class RegBitsTable;
 
 class RegPanel : public QDialog, public Ui_Dialog
 {
@@ -39,6 +53,24 @@ public:
     void warning_box(const QString &title, const QString &text);
     void error_box(const QString &title, const QString &text);
 
+    // Loads a report of stats biz (see reg_stats.hpp), whose flagged fields are annotated in register tables.
+    bool load_field_annotations(const QString &path);
+
+    /*
+     * Restores selections, register values and scroll position saved by the previous session, if any.
+     * It's deferred until the configuration directory is scanned if called before that, and returns true.
+     */
+    bool restore_session(const QString &path);
+
+    // Saves the session to path periodically in background, and on closing the window.
+    void enable_session_autosave(const QString &path);
+
+    /*
+     * Caps the memory of speculative prefetching, half for other files of the selected chip
+     * and half for register tables pre-built for all modules of the current file. It's disabled if 0.
+     */
+    void set_prefetch_cap(size_t bytes);
+
 public:
     inline const std::string& config_dir(void) const
     {
@@ -72,23 +104,91 @@ private slots:
     void on_lstAddrBaseMethod_currentIndexChanged(int index);
     void on_chkboxAsInput_stateChanged(int checked);
     void on_btnConvert_clicked(void);
+    void on_edtSearch_textChanged(const QString &text);
+    void on_lstSearchResult_itemActivated(QListWidgetItem *item);
+    void on_lstViewFilter_currentIndexChanged(int index);
+    void on_edtViewFilter_editingFinished(void);
+    void on_btnUndo_clicked(void);
+    void on_btnRedo_clicked(void);
+    void record_register_edit(uint64_t old_value, uint64_t new_value);
+    void autosave_session(void);
+    void prebuild_register_tables(void);
 
 private:
-    void scan_config_directory(const char *config_dir);
+    struct PreloadedConfig
+    {
+        QString path;
+        QJsonDocument json;
+        RegConfig config;
+        RegConfigStamps stamps;
+    };
+
+    struct StartupResult
+    {
+        QString err_msg; // empty if scanned successfully
+        std::vector<VendorItem> vendors;
+        std::unique_ptr<PreloadedConfig> first_config; // the one selected by default, nullptr if failed
+    };
+
+    // Thread-safe, for scanning in background.
+    static bool scan_config_directory(const std::string &config_dir, std::vector<VendorItem> &vendors,
+        QString *err_msg);
+    static QString config_file_path(const std::string &config_dir, const QString &vendor,
+        const QString &chip, const QString &file);
+    void finish_startup(std::shared_ptr<StartupResult> result);
     bool load_config_file(const char *path);
+    void schedule_prefetch(int vendor_idx, int chip_idx, int file_idx);
+    bool prepare_soc_map(void);
+    void update_reg_addr_map(const QString &module_name);
     QTableWidget* make_register_table(QWidget *parent, const QString &name_prefix,
         const QString &dict_key, const QJsonArray &dict_value,
         uint64_t default_value, uint64_t current_value);
-    int make_register_tables(const QJsonDocument &json, const QString &module_name);
+    QTableWidget* build_register_table(QWidget *parent, const QString &layout_key,
+        const QString &name_prefix, const QString &dict_key, const QJsonArray &dict_value,
+        uint64_t default_value, uint64_t current_value);
+    QTableWidget* reuse_register_table(const QString &layout_key, const QString &name_prefix,
+        const QString &dict_key, uint64_t default_value, uint64_t current_value);
+    void track_register_edits(QTableWidget *reg_table);
+    void apply_register_edits(const std::vector<RegEditJournal::Entry> &deltas, bool is_redo);
+    void update_undo_buttons(void);
+    void annotate_register_table(QTableWidget *reg_table, const QString &module_name, const QString &reg_key);
+    void flag_register_issue(QTableWidget *reg_table, const RegIssue &issue);
+    // Makes the table of only_key if it's not empty, or those of all registers of module otherwise.
+    int make_register_tables(const QJsonDocument &json, const QString &module_name,
+        const QString &only_key = QString());
     int make_register_tables(const QTextEdit &textbox, const QString &module_name);
+    int make_register_tables(const std::vector<RegSessionItem> &items);
+    RegSession capture_session(void) const;
     void clear_register_tables(void);
+    void refresh_register_tables(void);
+    void update_view_title(int count);
     int generate_register_array_items(const QString &module_name, const QTextEdit &textbox);
 
 private:
     std::string m_config_dir;
     std::vector<VendorItem> m_vendors;
     QJsonDocument m_json;
+    RegConfig m_config; // compiled from m_json
     std::map<uint64_t, std::string> m_reg_addr_map;
+    SocAddrMap m_soc_map;
+    std::map<QString, QString> m_field_notes; // key: "module\nregister\nbits"
+    std::multimap<QString, QTableWidget *> m_table_pool; // hidden register tables, key: compact JSON of bits items
+    RegSearchIndex m_search_index; // of all configuration files, built in background
+    std::vector<RegSearchIndex::Entry> m_search_hits; // shown in lstSearchResult
+    RegFilter m_view_filter;
+    int m_filtered_count; // of the last make_register_tables()
+    RegEditJournal m_edit_journal; // of register tables shown, cleared along with them
+    std::vector<RegBitsTable *> m_journal_tables; // indexed by register ids of the journal
+    RegSessionAutosaver m_session_autosaver;
+    QTimer *m_autosave_timer; // nullptr until autosave is enabled
+    std::thread m_startup_loader; // scans the configuration directory and loads the first file in background
+    RegConfigPrefetcher m_prefetcher; // taken from by load_config_file() first
+    QTimer *m_prebuild_timer; // pre-builds tables into m_table_pool while idle
+    std::deque<std::pair<QString, QJsonArray>> m_prebuild_queue; // layout keys and bits items
+    size_t m_prebuild_cap; // in bytes, of m_table_pool
+    size_t m_pooled_bytes; // estimated, of m_table_pool
+    bool m_started; // configuration directory scanned, and widgets of both tab pages prepared
+    QString m_pending_session; // restored once started
     int m_prev_vendor_idx;
     int m_prev_chip_idx;
     int m_prev_file_idx;
@@ -120,5 +220,22 @@ private:
  *  01. Add closeEvent() for capturing window close event.
  *  02. Add on_tab_currentChanged() and m_prev_*_idx to support
  *      refreshing tables only when the tab page is switched.
+ *
+ * >>> 2026-10-18, agent <agent@local>:
+ *  01. Add m_soc_map and prepare_soc_map() to support decoding
+ *      physical addresses of all modules of a chip in one pass.
+ *  02. Add load_field_annotations() and annotate_register_table() to show
+ *      anomalies found by stats biz in register tables.
+ *  03. Add m_config and flag_register_issue() to validate pasted register values.
+ *  04. Add m_table_pool and reuse_register_table() to recycle register tables.
+ *  05. Add m_search_index and slots of searching registers across all configuration files.
+ *  06. Add m_view_filter and its slots to show only registers of interest.
+ *  07. Add m_edit_journal and slots of undoing and redoing edits of register values.
+ *  08. Add restore_session(), enable_session_autosave() and capture_session()
+ *      to save and restore sessions via binary snapshots.
+ *  09. Add m_startup_loader, m_preloaded and finish_startup() to scan the configuration
+ *      directory and load the first file in background.
+ *  10. Replace m_preloaded with m_prefetcher, and add set_prefetch_cap() and
+ *      prebuild_register_tables() to prefetch other files and pre-build register tables.
  */
 
@@ -6,9 +6,15 @@ CONFIG += c++11 qt warn_on release
 exists($${TARGET}.debug.pri) {
     include($${TARGET}.debug.pri) # Should contain: CONFIG += debug
 }
+include(regpanel-common.pri)
 
 FORMS += *.ui
 HEADERS += $${TARGET}.hpp private_widgets.hpp
 SOURCES += *.cpp
 QT += widgets
 
+# Widget-free logics, see core/regpanel-core.pro.
+INCLUDEPATH += core
+LIBS += -Lcore -lregpanel-core
+PRE_TARGETDEPS += core/libregpanel-core.a
+